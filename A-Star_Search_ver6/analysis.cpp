@@ -0,0 +1,217 @@
+/* 
+ * File:   analysis.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <cstdio>
+#include <queue>
+#include <unordered_map>
+#include "analysis.h"
+using namespace std;
+
+const unsigned int STATE_COUNT = 362880;    // 9!
+const unsigned char UNKNOWN = 0xFF;
+const int HEURISTIC_COUNT = 3;
+const char *heuristicNames[HEURISTIC_COUNT] = { "Uniform Cost", "Misplaced Tile", "Manhattan Distance" };
+const int MAX_ERROR = 32;                   // Histogram buckets, the last one catches the rest
+
+// =======================================================================
+// Lehmer code of the tiles in reading order: for every cell, how many of
+// the cells after it hold a smaller tile, weighted by factorials
+// =======================================================================
+unsigned int stateRank(unsigned long long packed) {
+    unsigned int rank = 0;
+    for(int i = 0; i < CELLS; i++) {
+        int tile = (packed >> (4*i)) & 0xF;
+        int smaller = 0;
+        for(int j = i+1; j < CELLS; j++) {
+            if(((packed >> (4*j)) & 0xF) < (unsigned)tile) smaller++;
+        }
+        rank = rank * (CELLS - i) + smaller;
+    }
+    return rank;
+}
+
+// ==============================================================================
+// Breadth-first search backwards from the goal, built the first time it's asked
+// for (about 180k states, a fraction of a second)
+// ==============================================================================
+const vector<unsigned char> &distanceTable() {
+    static vector<unsigned char> table;
+    if(!table.empty()) return table;
+    table.assign(STATE_COUNT, UNKNOWN);
+    
+    unsigned long long goal = 0;
+    for(int i = 0; i < CELLS-1; i++) goal |= (unsigned long long)(i+1) << (4*i);
+    queue<unsigned long long> frontier;
+    frontier.push(goal);
+    table[stateRank(goal)] = 0;
+    
+    while(!frontier.empty()) {
+        unsigned long long curr = frontier.front();
+        frontier.pop();
+        unsigned char dist = table[stateRank(curr)];
+        int blank = 0;
+        while((curr >> (4*blank)) & 0xF) blank++;
+        int bx = blank % 3, by = blank / 3;
+        // Left, right, up, down neighbours of the blank
+        int moves[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        for(int i = 0; i < 4; i++) {
+            int nx = bx + moves[i][0], ny = by + moves[i][1];
+            if(nx < 0 || nx >= 3 || ny < 0 || ny >= 3) continue;
+            int cell = ny*3 + nx;
+            unsigned long long tile = (curr >> (4*cell)) & 0xF;
+            unsigned long long next = (curr & ~(0xFULL << (4*cell))) | (tile << (4*blank));
+            unsigned int r = stateRank(next);
+            if(table[r] == UNKNOWN) {
+                table[r] = dist + 1;
+                frontier.push(next);
+            }
+        }
+    }
+    return table;
+}
+
+// =================================================================
+// Bisection on the b* in n + 1 = 1 + b* + ... + b*^d, good to 1e-6
+// =================================================================
+double effectiveBranching(unsigned long long n, unsigned long long depth) {
+    if(depth == 0 || n == 0) return 0;
+    double lo = 0, hi = n;
+    if(hi < 1) hi = 1;
+    for(int iter = 0; iter < 200 && hi - lo > 1e-6; iter++) {
+        double mid = (lo + hi) / 2, total = 1, term = 1;
+        for(unsigned long long i = 1; i <= depth && total <= n + 1; i++) {
+            term *= mid;
+            total += term;
+        }
+        if(total > n + 1) hi = mid;
+        else lo = mid;
+    }
+    return (lo + hi) / 2;
+}
+
+static unsigned long long searchKey(unsigned long long g, int h) {
+    return ((g + h) << 16) | (0xFFFF - g);
+}
+
+// ======================================================================
+// Quiet A* on packed states with a hash map for duplicates, only used to
+// count how many nodes each heuristic makes the search expand
+// ======================================================================
+static unsigned long long countExpansions(const Node &start, short ver, unsigned long long &depth) {
+    // (key, state), the key sorts by f(n) and breaks ties towards deeper nodes
+    typedef pair<unsigned long long, unsigned long long> Entry;
+    priority_queue<Entry, vector<Entry>, greater<Entry> > open;
+    unordered_map<unsigned long long, unsigned long long> bestG;
+    unsigned long long startState = packState(start);
+    open.push(Entry(searchKey(0, heuristic(start, ver)), startState));
+    bestG[startState] = 0;
+    unsigned long long expanded = 0;
+    
+    while(!open.empty()) {
+        Entry top = open.top();
+        open.pop();
+        Node curr = unpackState(top.second);
+        unsigned long long g = bestG[top.second];
+        int h = heuristic(curr, ver);
+        if(top.first != searchKey(g, h)) continue;  // Stale entry, a cheaper copy was already expanded
+        if(distanceTable()[stateRank(top.second)] == 0) {
+            depth = g;
+            return expanded;
+        }
+        expanded++;
+        pair<int, int> zeroPos = findNumPos(curr, 0);
+        pair<int, int> adjacentArr[4] = { pair<int, int>(0, -1), pair<int, int>(1, 0),
+                                          pair<int, int>(0, 1), pair<int, int>(-1, 0) };
+        for(int i = 0; i < 4; i++) {
+            pair<int, int> adjPos(zeroPos.first + adjacentArr[i].first, zeroPos.second + adjacentArr[i].second);
+            if(adjPos.first < 0 || adjPos.first >= 3 || adjPos.second < 0 || adjPos.second >= 3) continue;
+            Node child = curr;
+            nodeNumSwap(child, zeroPos, adjPos);
+            unsigned long long packed = packState(child);
+            unordered_map<unsigned long long, unsigned long long>::iterator it = bestG.find(packed);
+            if(it != bestG.end() && it->second <= g+1) continue;
+            bestG[packed] = g+1;
+            open.push(Entry(searchKey(g+1, heuristic(child, ver)), packed));
+        }
+    }
+    depth = 0;
+    return expanded;
+}
+
+// =====================================================================
+// Evenly spaced sample of the states the search reached, then for each
+// heuristic: how far below h* it is, how close the ratio is to 1 and how
+// much it actually prunes (b*) when used for the same start state
+// =====================================================================
+void analyzeHeuristics(const vector<Node> &states, const Node &start, int maxSamples, ostream &out) {
+    const vector<unsigned char> &table = distanceTable();
+    if(table[stateRank(packState(start))] == UNKNOWN) {
+        out << "Start state is unsolvable, nothing to analyze" << endl;
+        return;
+    }
+    size_t step = 1;
+    if(maxSamples > 0 && states.size() > (size_t)maxSamples) step = states.size() / maxSamples;
+    
+    out << endl << "HEURISTIC ACCURACY" << endl;
+    char line[160];
+    snprintf(line, sizeof(line), "%-20s %8s %8s %8s %8s %10s %8s %8s\n",
+             "Heuristic", "samples", "mean h", "mean h*", "h/h*", "exact", "expanded", "b*");
+    out << line;
+    
+    vector<unsigned long long> histograms[HEURISTIC_COUNT];
+    for(int ver = 1; ver <= HEURISTIC_COUNT; ver++) {
+        vector<unsigned long long> &hist = histograms[ver-1];
+        hist.assign(MAX_ERROR+1, 0);
+        unsigned long long samples = 0, exact = 0, ratioSamples = 0;
+        double sumH = 0, sumTrue = 0, sumRatio = 0;
+        for(size_t i = 0; i < states.size(); i += step) {
+            int trueDist = table[stateRank(packState(states[i]))];
+            int h = heuristic(states[i], ver);
+            int error = trueDist - h;
+            hist[error < 0 ? 0 : (error > MAX_ERROR ? MAX_ERROR : error)]++;
+            if(error == 0) exact++;
+            if(trueDist > 0) {
+                sumRatio += (double)h / trueDist;
+                ratioSamples++;
+            }
+            sumH += h;
+            sumTrue += trueDist;
+            samples++;
+        }
+        unsigned long long depth = 0;
+        unsigned long long expanded = countExpansions(start, ver, depth);
+        snprintf(line, sizeof(line), "%-20s %8llu %8.2f %8.2f %8.3f %9.1f%% %8llu %8.3f\n",
+                 heuristicNames[ver-1], samples, samples ? sumH / samples : 0.0,
+                 samples ? sumTrue / samples : 0.0, ratioSamples ? sumRatio / ratioSamples : 1.0,
+                 samples ? 100.0 * exact / samples : 0.0, expanded, effectiveBranching(expanded, depth));
+        out << line;
+    }
+    
+    // One row per error value (h* - h), one column per heuristic
+    out << endl << "Error histogram (h* - h), fraction of samples:" << endl;
+    snprintf(line, sizeof(line), "%6s", "error");
+    out << line;
+    for(int ver = 0; ver < HEURISTIC_COUNT; ver++) {
+        snprintf(line, sizeof(line), " %20s", heuristicNames[ver]);
+        out << line;
+    }
+    out << endl;
+    unsigned long long total = 0;
+    for(int e = 0; e <= MAX_ERROR; e++) total += histograms[0][e];
+    for(int e = 0; e <= MAX_ERROR; e++) {
+        bool any = false;
+        for(int ver = 0; ver < HEURISTIC_COUNT; ver++) any = any || histograms[ver][e];
+        if(!any) continue;
+        snprintf(line, sizeof(line), e == MAX_ERROR ? "%5d+" : "%6d", e);
+        out << line;
+        for(int ver = 0; ver < HEURISTIC_COUNT; ver++) {
+            snprintf(line, sizeof(line), " %20.3f", total ? (double)histograms[ver][e] / total : 0.0);
+            out << line;
+        }
+        out << endl;
+    }
+}
@@ -0,0 +1,35 @@
+/* 
+ * File:   analysis.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Heuristic accuracy analysis for the 3x3 puzzle
+// Compares every heuristic() version against the true distance h*(n), taken
+// from an exact distance table built by a backwards breadth-first search over
+// all 9!/2 solvable states
+
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include <iostream>
+#include <vector>
+#include "puzzle.h"
+
+// Index of a 3x3 state in the distance table (its permutation rank)
+unsigned int stateRank(unsigned long long packed);
+
+// h*(n) for every state, indexed by stateRank(), 0xFF for unsolvable states
+const std::vector<unsigned char> &distanceTable();
+
+// Sample up to maxSamples of the given states and report, per heuristic,
+// the error histogram (h* - h), mean h/h* and the effective branching
+// factor of an A* run from start
+void analyzeHeuristics(const std::vector<Node> &states, const Node &start, int maxSamples, std::ostream &out);
+
+// Effective branching factor b* for a search that expanded n nodes to find a
+// solution at the given depth, ie. n + 1 = 1 + b* + b*^2 + ... + b*^depth
+double effectiveBranching(unsigned long long n, unsigned long long depth);
+
+#endif /* ANALYSIS_H */
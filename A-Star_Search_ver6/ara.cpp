@@ -0,0 +1,223 @@
+/* 
+ * File:   ara.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <queue>
+#include <unordered_map>
+#include "ara.h"
+#include "util.h"
+using namespace std;
+
+const unsigned long long INF = ULLONG_MAX;
+
+// What ARA* remembers about each state it has generated
+struct AraRecord {
+    unsigned long long g;
+    unsigned long long parent;      // Packed parent state, the start points at itself
+    unsigned short hn;
+    bool inOpen, closed, incons;
+};
+
+// Queue entry: f'(n) = g(n) + w*h(n) at the time it was pushed. Entries go
+// stale when a state gets a cheaper g(n) or w changes, they're skipped when popped
+struct AraEntry {
+    double key;
+    unsigned long long g;
+    unsigned long long state;
+};
+// Same idea as cmpClass, but on the weighted f and breaking ties towards
+// the deeper node (weighted A* dives much better that way)
+class weightedCmpClass {
+    public:
+    bool operator()(const AraEntry &lhs, const AraEntry &rhs) {
+        if(lhs.key != rhs.key) return lhs.key > rhs.key;
+        return lhs.g < rhs.g;
+    }
+};
+typedef priority_queue<AraEntry, vector<AraEntry>, weightedCmpClass> AraQueue;
+
+class AraSearch {
+    public:
+    AraSearch(short algorithm) : algorithm(algorithm), expansions(0), maxQueue(0) {}
+    SearchResult run(const Node &start, double weight, double weightStep, const SearchBudget &budget,
+                     vector<Node> &path, SearchObserver *observer);
+    
+    private:
+    SearchStatus improvePath(double weight, const SearchBudget &budget, long long startTime);
+    void push(unsigned long long state, const AraRecord &rec, double weight);
+    void rebuildOpen(double weight);
+    unsigned long long openLowerBound();
+    void buildPath(vector<Node> &path);
+    
+    short algorithm;
+    unordered_map<unsigned long long, AraRecord> states;
+    AraQueue open;
+    vector<unsigned long long> incons;      // Closed states that got cheaper, waiting for the next round
+    unsigned long long startState, goalState;
+    unsigned long long expansions, maxQueue;
+};
+
+void AraSearch::push(unsigned long long state, const AraRecord &rec, double weight) {
+    AraEntry e = { rec.g + weight * rec.hn, rec.g, state };
+    open.push(e);
+    if(open.size() > maxQueue) maxQueue = open.size();
+}
+
+// =========================================================================
+// Weighted A* pass: expand until nothing left in open could beat the
+// current goal g(n). Closed states that improve go to incons instead of
+// being reopened, that's what keeps each pass cheap
+// =========================================================================
+SearchStatus AraSearch::improvePath(double weight, const SearchBudget &budget, long long startTime) {
+    while(!open.empty()) {
+        AraEntry top = open.top();
+        unordered_map<unsigned long long, AraRecord>::iterator goalIt = states.find(goalState);
+        unsigned long long goalG = goalIt == states.end() ? INF : goalIt->second.g;
+        if(goalG != INF && (double)goalG <= top.key) return SOLVED;
+        open.pop();
+        AraRecord &rec = states[top.state];
+        if(!rec.inOpen || rec.g != top.g) continue;     // Stale entry
+        
+        publishCounters(budget, expansions, (unsigned long long)top.key, open.size(), states.size());
+        SearchStatus status = checkBudget(budget, startTime, expansions,
+                                          states.size() * (sizeof(AraRecord) + 2*sizeof(unsigned long long)));
+        if(status != WITHIN_BUDGET) {
+            open.push(top);     // Still open, the lower bound needs it
+            return status;
+        }
+        expansions++;
+        rec.inOpen = false;
+        rec.closed = true;
+        unsigned long long g = rec.g;
+        
+        Node children[4];
+        int n = generateChildren(unpackState(top.state), children);
+        for(int c = 0; c < n; c++) {
+            unsigned long long childState = packState(children[c]);
+            unordered_map<unsigned long long, AraRecord>::iterator it = states.find(childState);
+            if(it == states.end()) {
+                AraRecord fresh = { INF, 0, (unsigned short)heuristic(children[c], algorithm), false, false, false };
+                it = states.insert(make_pair(childState, fresh)).first;
+            }
+            AraRecord &child = it->second;
+            if(child.g <= g + 1) continue;
+            child.g = g + 1;
+            child.parent = top.state;
+            if(!child.closed) {
+                child.inOpen = true;
+                push(childState, child, weight);
+            }
+            else if(!child.incons) {
+                child.incons = true;
+                incons.push_back(childState);
+            }
+        }
+    }
+    return states.count(goalState) && states[goalState].g != INF ? SOLVED : NO_SOLUTION;
+}
+
+// ========================================================================
+// Start of a new pass with a smaller w: open gets everything from incons,
+// every key is recomputed and closed is emptied
+// ========================================================================
+void AraSearch::rebuildOpen(double weight) {
+    AraQueue fresh;
+    open.swap(fresh);
+    for(size_t i = 0; i < incons.size(); i++) {
+        AraRecord &rec = states[incons[i]];
+        rec.incons = false;
+        rec.inOpen = true;
+    }
+    incons.clear();
+    for(unordered_map<unsigned long long, AraRecord>::iterator it = states.begin(); it != states.end(); ++it) {
+        it->second.closed = false;
+        if(it->second.inOpen) push(it->first, it->second, weight);
+    }
+}
+
+// ======================================================================
+// min g(n) + h(n) over open and incons, the optimal solution can't be
+// shorter than that (or than the goal's own g(n) if nothing is left)
+// ======================================================================
+unsigned long long AraSearch::openLowerBound() {
+    unsigned long long bound = INF;
+    for(unordered_map<unsigned long long, AraRecord>::iterator it = states.begin(); it != states.end(); ++it) {
+        const AraRecord &rec = it->second;
+        if(rec.inOpen || rec.incons) bound = min(bound, rec.g + rec.hn);
+    }
+    unordered_map<unsigned long long, AraRecord>::iterator goalIt = states.find(goalState);
+    if(goalIt != states.end()) bound = min(bound, goalIt->second.g);
+    return bound;
+}
+
+void AraSearch::buildPath(vector<Node> &path) {
+    path.clear();
+    for(unsigned long long s = goalState; ; s = states[s].parent) {
+        Node node = unpackState(s);
+        node.gn = states[s].g;
+        node.hn = states[s].hn;
+        path.push_back(node);
+        if(s == startState) break;
+    }
+    reverse(path.begin(), path.end());
+}
+
+// =========================================================================
+// Run passes with w going down by weightStep each time until w hits 1 (at
+// which point the solution is optimal) or the budget runs out
+// =========================================================================
+SearchResult AraSearch::run(const Node &start, double weight, double weightStep, const SearchBudget &budget,
+                            vector<Node> &path, SearchObserver *observer) {
+    SearchResult result;
+    long long startTime = nowMicros();
+    if(weight < 1) weight = 1;
+    if(weightStep <= 0) weightStep = weight;    // Jump straight to 1 after the first pass
+    startState = packState(start);
+    goalState = packState(goalNode());
+    AraRecord root = { 0, startState, (unsigned short)heuristic(start, algorithm), true, false, false };
+    states[startState] = root;
+    push(startState, root, weight);
+    
+    while(true) {
+        SearchStatus status = improvePath(weight, budget, startTime);
+        if(status == SOLVED) {
+            unsigned long long goalG = states[goalState].g;
+            if(path.empty() || goalG < result.depth) {
+                buildPath(path);
+                result.depth = goalG;
+                unsigned long long bound = openLowerBound();
+                if(observer) observer->improved(path, bound ? min(weight, (double)goalG / bound) : 1.0);
+            }
+            result.status = SOLVED;
+            if(weight <= 1) break;
+            weight = max(1.0, weight - weightStep);
+            rebuildOpen(weight);
+        }
+        else {
+            // Out of budget (or out of states), keep the best solution so far if there is one
+            if(path.empty()) result.status = status;
+            break;
+        }
+    }
+    result.lowerBound = min(openLowerBound(), result.status == SOLVED ? result.depth : INF);
+    if(result.lowerBound == INF) result.lowerBound = 0;
+    result.expansions = expansions;
+    result.maxQueueSize = maxQueue;
+    result.memoryBytes = states.size() * (sizeof(AraRecord) + 2*sizeof(unsigned long long));
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+// =======================================
+// Anytime search starting from weight w
+// =======================================
+SearchResult araStar(const Node &start, const short algorithm, double weight, double weightStep,
+                     const SearchBudget &budget, vector<Node> &path, SearchObserver *observer) {
+    AraSearch search(algorithm);
+    return search.run(start, weight, weightStep, budget, path, observer);
+}
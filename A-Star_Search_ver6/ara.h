@@ -0,0 +1,27 @@
+/* 
+ * File:   ara.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Anytime repairing A* (ARA*)
+// Starts as weighted A* ordering by g(n) + w*h(n), which finds a solution
+// at most w times longer than optimal very quickly, then keeps lowering w
+// and repairing the search it already has instead of starting over. Every
+// improved solution is handed to the observer as soon as it's found, and
+// with w back down to 1 the last one is optimal. Stop it early with a
+// time/expansion budget and the result holds the best solution so far plus
+// a proven lower bound.
+
+#ifndef ARA_H
+#define ARA_H
+
+#include <vector>
+#include "puzzle.h"
+
+// observer (NULL for none) gets each improved solution, see SearchObserver::improved()
+SearchResult araStar(const Node &start, const short algorithm, double weight, double weightStep,
+                     const SearchBudget &budget, std::vector<Node> &path, SearchObserver *observer);
+
+#endif /* ARA_H */
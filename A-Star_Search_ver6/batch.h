@@ -0,0 +1,36 @@
+/* 
+ * File:   batch.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Reading a file full of boards, one board per line
+// Each line holds side*side tile numbers in reading order (blank = 0),
+// separated by anything that isn't a digit, so "1 2 3 4 5 6 7 8 0" and
+// "1,2,3,4,5,6,7,8,0" both work. Blank lines and lines starting with '#' are
+// skipped. The file is memory-mapped and scanned in place, numbers go
+// straight into packed states, and each board is checked to be a
+// permutation as it's read. Bad lines are reported and left out.
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <string>
+#include <vector>
+#include "puzzle.h"
+
+struct BatchInput {
+    std::vector<unsigned long long> boards;     // Packed, in file order
+    std::vector<unsigned long long> lines;      // Line each board came from, starting at 1
+    std::vector<std::string> errors;            // "line N: what's wrong", one per bad line
+    unsigned long long bytes;                   // Size of the file
+};
+
+// False if the file couldn't be read at all
+bool parseBatch(const std::string &fileName, int side, BatchInput &input);
+
+// Whether the goal can be reached from a packed board at all (permutation parity)
+bool isSolvable(unsigned long long packed, int side);
+
+#endif /* BATCH_H */
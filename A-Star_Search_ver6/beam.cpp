@@ -0,0 +1,113 @@
+/* 
+ * File:   beam.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <unordered_set>
+#include "beam.h"
+#include "simd.h"
+#include "util.h"
+using namespace std;
+
+// Give up past this depth, a beam that lost the goal can wander forever
+const unsigned long long BEAM_MAX_DEPTH = 100000;
+
+// Orders a layer best h(n) first
+class beamCmpClass {
+    public:
+    bool operator()(const Node &lhs, const Node &rhs) {
+        return lhs.hn < rhs.hn;
+    }
+};
+
+// ===========================================================================
+// Expand the whole layer, drop children already in this layer or the last
+// one (the only places a slide can lead back to), keep the best width
+// ===========================================================================
+SearchResult beamSearch(const Node &start, const short algorithm, unsigned long long width,
+                        const SearchBudget &budget, vector<Node> &path) {
+    SearchResult result;
+    long long startTime = nowMicros();
+    Node goal = goalNode();
+    if(width < 1) width = 1;
+    
+    vector<Node> layer(1, start), next;
+    layer[0].hn = heuristic(start, algorithm);
+    layer.reserve(width);
+    next.reserve(width * 4);
+    // Packed states of the previous and current layer, for duplicate removal
+    unordered_set<unsigned long long> previous, current, seen;
+    // The next layer's packed states and their h(n), filled in a batch
+    vector<unsigned long long> nextPacked;
+    vector<unsigned short> nextH;
+    current.insert(packState(start));
+    
+    // Beam search proves nothing about optimality, h(start) is all we know
+    result.lowerBound = layer[0].hn;
+    result.status = NO_SOLUTION;
+    for(unsigned long long depth = 0; !layer.empty() && depth <= BEAM_MAX_DEPTH; depth++) {
+        for(size_t i = 0; i < layer.size(); i++) {
+            if(testState(goal, layer[i])) {
+                result.status = SOLVED;
+                result.depth = depth;
+                path.assign(1, layer[i]);
+                break;
+            }
+        }
+        if(result.status == SOLVED) break;
+        
+        // Once a layer, so no skipping checks in between (see checkBudgetNow())
+        SearchStatus status = checkBudgetNow(budget, startTime, result.expansions,
+                                             (layer.capacity() + next.capacity()) * sizeof(Node));
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            break;
+        }
+        
+        // Generate every child of the layer, one copy of each state
+        next.clear();
+        seen.clear();
+        nextPacked.clear();
+        // A wide layer takes a while, so look at the budget as it goes too
+        for(size_t i = 0; i < layer.size(); i++) {
+            publishCounters(budget, result.expansions + i, depth, layer.size() - i, previous.size() + current.size());
+            status = checkBudget(budget, startTime, result.expansions + i,
+                                 (layer.capacity() + next.capacity()) * sizeof(Node));
+            if(status != WITHIN_BUDGET) break;
+            Node children[4];
+            int n = generateChildren(layer[i], children);
+            for(int c = 0; c < n; c++) {
+                unsigned long long state = packState(children[c]);
+                if(previous.count(state) || current.count(state) || !seen.insert(state).second) continue;
+                next.push_back(children[c]);
+                nextPacked.push_back(state);
+            }
+        }
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            break;
+        }
+        // h(n) for the whole layer in one go
+        nextH.resize(next.size());
+        if(!next.empty()) batchHeuristic(&nextPacked[0], next.size(), algorithm, &nextH[0]);
+        for(size_t i = 0; i < next.size(); i++) next[i].hn = nextH[i];
+        result.expansions += layer.size();
+        result.maxQueueSize = max(result.maxQueueSize, (unsigned long long)next.size());
+        
+        // Only the best width survive
+        if(next.size() > width) {
+            nth_element(next.begin(), next.begin() + width, next.end(), beamCmpClass());
+            next.resize(width);
+        }
+        layer.swap(next);
+        previous.swap(current);
+        current.clear();
+        for(size_t i = 0; i < layer.size(); i++) current.insert(packState(layer[i]));
+    }
+    result.memoryBytes = (layer.capacity() + next.capacity()) * sizeof(Node);
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
@@ -0,0 +1,23 @@
+/* 
+ * File:   beam.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Beam search: breadth-first, but only the best width nodes of each layer
+// (by h(n), g(n) is the same for the whole layer) survive to be expanded.
+// Fast and suboptimal, takes O(width x depth) time and only ever holds two
+// layers, so O(width) memory. Because of that the solution path isn't kept,
+// only its depth and the goal node.
+
+#ifndef BEAM_H
+#define BEAM_H
+
+#include <vector>
+#include "puzzle.h"
+
+SearchResult beamSearch(const Node &start, const short algorithm, unsigned long long width,
+                        const SearchBudget &budget, std::vector<Node> &path);
+
+#endif /* BEAM_H */
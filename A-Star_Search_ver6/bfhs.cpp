@@ -0,0 +1,206 @@
+/* 
+ * File:   bfhs.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <unordered_map>
+#include "bfhs.h"
+#include "bitboard.h"
+#include "util.h"
+using namespace std;
+
+// Board -> board its path went through at the relay layer (0 before it)
+typedef unordered_map<unsigned long long, unsigned long long> Layer;
+
+template <int N>
+class BfhsSearch {
+    public:
+    BfhsSearch(short algorithm, const SearchBudget &budget)
+        : algorithm(algorithm), budget(budget), startTime(nowMicros()), expansions(0), maxLayer(0), maxBytes(0),
+          status(WITHIN_BUDGET) {}
+    SearchResult run(unsigned long long start, vector<unsigned long long> &path);
+    
+    private:
+    unsigned long long search(unsigned long long from, unsigned long long to, unsigned long long bound,
+                              unsigned long long relayDepth, unsigned long long &relay);
+    bool solveSegment(unsigned long long from, unsigned long long to, unsigned long long depth,
+                      vector<unsigned long long> &path);
+    int cost(int tile, int cell) const;
+    int estimate(unsigned long long from) const;
+    
+    short algorithm;
+    const SearchBudget &budget;
+    int home[N*N];                  // Cell each tile is in on the current target board
+    long long startTime;
+    unsigned long long expansions;
+    unsigned long long maxLayer;
+    unsigned long long maxBytes;
+    SearchStatus status;            // Set when the budget stops a search
+};
+
+// h(n) contribution of tile sitting in cell, towards the current target
+template <int N>
+int BfhsSearch<N>::cost(int tile, int cell) const {
+    if(tile == 0 || algorithm == 1) return 0;
+    if(algorithm == 2) return cell != home[tile];
+    return abs(cell % N - home[tile] % N) + abs(cell / N - home[tile] / N);
+}
+
+template <int N>
+int BfhsSearch<N>::estimate(unsigned long long from) const {
+    int hn = 0;
+    for(int cell = 0; cell < N*N; cell++) hn += cost(packedTile(from, cell), cell);
+    return hn;
+}
+
+// Where the blank is on a packed board
+static int packedBlank(unsigned long long packed) {
+    int cell = 0;
+    while(packedTile(packed, cell)) cell++;
+    return cell;
+}
+
+// ===========================================================================
+// One breadth-first pass from from to to, cutting anything with f(n) over
+// bound. Returns the depth to was found at (relay gets the board at
+// relayDepth on the way), or if it wasn't, ULLONG_MAX - the smallest f(n)
+// that got cut, ULLONG_MAX if nothing was. 0 with status set if the budget
+// ran out
+// ===========================================================================
+template <int N>
+unsigned long long BfhsSearch<N>::search(unsigned long long from, unsigned long long to, unsigned long long bound,
+                                         unsigned long long relayDepth, unsigned long long &relay) {
+    for(int cell = 0; cell < N*N; cell++) home[packedTile(to, cell)] = cell;
+    Layer previous, current, next;
+    current[from] = relayDepth == 0 ? from : 0;
+    unsigned long long cut = ULLONG_MAX;
+    
+    for(unsigned long long depth = 0; !current.empty(); depth++) {
+        Layer::iterator found = current.find(to);
+        if(found != current.end()) {
+            relay = found->second;
+            return depth;
+        }
+        
+        for(Layer::iterator it = current.begin(); it != current.end(); ++it) {
+            unsigned long long bytes = (previous.size() + current.size() + next.size())
+                                     * (2*sizeof(unsigned long long) + 2*sizeof(void *));
+            maxBytes = max(maxBytes, bytes);
+            publishCounters(budget, expansions, bound, current.size() + next.size(), previous.size());
+            status = checkBudget(budget, startTime, expansions, bytes);
+            if(status != WITHIN_BUDGET) return 0;
+            expansions++;
+            
+            // h(n) of each child is the parent's plus the change for the tile that slid
+            unsigned long long state = it->first;
+            int blank = packedBlank(state);
+            int hn = estimate(state);
+            PackedChild children[4];
+            int n = packedChildren<N>(state, blank, children);
+            for(int c = 0; c < n; c++) {
+                unsigned long long child = children[c].state;
+                int tile = children[c].tile;
+                unsigned long long f = depth + 1 + hn - cost(tile, children[c].blank) + cost(tile, blank);
+                if(f > bound) {
+                    cut = min(cut, f);
+                    continue;
+                }
+                if(previous.count(child) || current.count(child) || next.count(child)) continue;
+                next[child] = depth + 1 == relayDepth ? child : it->second;
+            }
+        }
+        maxLayer = max(maxLayer, (unsigned long long)next.size());
+        previous.swap(current);
+        current.swap(next);
+        next.clear();
+    }
+    return cut == ULLONG_MAX ? ULLONG_MAX : ULLONG_MAX - cut;
+}
+
+// ===========================================================================
+// Append the boards after from, up to and including to, which is known to be
+// depth moves away, by solving each half on its own
+// ===========================================================================
+template <int N>
+bool BfhsSearch<N>::solveSegment(unsigned long long from, unsigned long long to, unsigned long long depth,
+                                 vector<unsigned long long> &path) {
+    if(depth == 0) return true;
+    if(depth == 1) {
+        path.push_back(to);
+        return true;
+    }
+    unsigned long long half = depth / 2, relay = 0;
+    if(search(from, to, depth, half, relay) != depth) return false;
+    return solveSegment(from, relay, half, path) && solveSegment(relay, to, depth - half, path);
+}
+
+template <int N>
+SearchResult BfhsSearch<N>::run(unsigned long long start, vector<unsigned long long> &path) {
+    SearchResult result;
+    unsigned long long goal = 0;
+    for(int i = 0; i < N*N-1; i++) goal |= (unsigned long long)(i+1) << (4*i);
+    for(int cell = 0; cell < N*N; cell++) home[packedTile(goal, cell)] = cell;
+    
+    result.status = NO_SOLUTION;
+    unsigned long long bound = estimate(start);
+    while(true) {
+        // Relay halfway down the bound, the real depth isn't known yet
+        unsigned long long relayDepth = max(1ULL, bound / 2), relay = 0;
+        unsigned long long depth = search(start, goal, bound, relayDepth, relay);
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            result.lowerBound = bound;
+            break;
+        }
+        if(depth <= bound) {
+            result.status = SOLVED;
+            result.depth = result.lowerBound = depth;
+            path.assign(1, start);
+            if(depth <= relayDepth) relay = goal;
+            unsigned long long first = min(depth, relayDepth);
+            if(!solveSegment(start, relay, first, path) || !solveSegment(relay, goal, depth - first, path)) {
+                result.status = status;
+            }
+            break;
+        }
+        // Nothing got cut, so there's nothing more to find
+        if(depth == ULLONG_MAX) break;
+        bound = ULLONG_MAX - depth;
+    }
+    result.expansions = expansions;
+    result.maxQueueSize = maxLayer;
+    result.memoryBytes = maxBytes;
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+SearchResult bfhsPacked(unsigned long long start, int side, const short algorithm, const SearchBudget &budget,
+                        vector<unsigned long long> &path) {
+    if(side == 4) {
+        BfhsSearch<4> search(algorithm, budget);
+        return search.run(start, path);
+    }
+    BfhsSearch<3> search(algorithm, budget);
+    return search.run(start, path);
+}
+
+// ======================================================
+// 3x3 Nodes in and out, for the rest of the search modes
+// ======================================================
+SearchResult bfhsSearch(const Node &start, const short algorithm, const SearchBudget &budget, vector<Node> &path) {
+    vector<unsigned long long> packed;
+    SearchResult result = bfhsPacked(packState(start), SIDE, algorithm, budget, packed);
+    path.clear();
+    for(size_t i = 0; i < packed.size(); i++) {
+        path.push_back(unpackState(packed[i]));
+        path.back().gn = i;
+        path.back().hn = heuristic(path.back(), algorithm);
+        path.back().parent = (long long)i - 1;
+    }
+    return result;
+}
@@ -0,0 +1,34 @@
+/* 
+ * File:   bfhs.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Breadth-first heuristic search (Zhou & Hansen)
+// Breadth first, one depth at a time, but a board is dropped as soon as
+// g(n) + h(n) goes past an upper bound on the solution depth. Every move
+// changes the depth by exactly one, so a new board can only be a duplicate
+// of one in the layer before, the current layer or the next one, and those
+// three layers are all that's kept. Starting from h(start), the bound is
+// raised to the smallest f(n) that got cut until the goal is reached (so the
+// depth found is optimal). Like the frontier search, boards remember the
+// board their path went through at a middle layer, and the path is rebuilt
+// by solving each half again. Runs on packed boards, so 3x3 and 4x4 both work.
+
+#ifndef BFHS_H
+#define BFHS_H
+
+#include <vector>
+#include "puzzle.h"
+
+// side x side board packed with packState()'s layout, side 3 or 4. path gets
+// the solution (packed, start first) when the search succeeds
+SearchResult bfhsPacked(unsigned long long start, int side, const short algorithm, const SearchBudget &budget,
+                        std::vector<unsigned long long> &path);
+
+// The same for a 3x3 Node, path gets the solution as Nodes
+SearchResult bfhsSearch(const Node &start, const short algorithm, const SearchBudget &budget,
+                        std::vector<Node> &path);
+
+#endif /* BFHS_H */
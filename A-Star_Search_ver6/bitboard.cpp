@@ -0,0 +1,166 @@
+/* 
+ * File:   bitboard.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "bitboard.h"
+#include "puzzle.h"
+#include "simd.h"
+#include "util.h"
+using namespace std;
+
+const int BENCH_STATES = 4096;      // Distinct states per pass, small enough to stay in cache
+
+// ==========================================================================
+// The way expand() used to do it: find the blank, try all four offsets with
+// a bounds check each, copy the node and nodeNumSwap() the tile across
+// ==========================================================================
+static pair<int, int> scanNumPos(const Node &node, int num) {
+    // findNumPos() reads Node::pos now, so the old 3x3 scan lives on here
+    for(int y = 0; y < SIDE; y++)
+        for(int x = 0; x < SIDE; x++)
+            if(node.state[x][y] == num) return pair<int, int>(x, y);
+    return pair<int, int>(-1, -1);
+}
+
+static unsigned long long swapKernel(const vector<Node> &states, int passes) {
+    pair<int, int> adjacentArr[4] = { pair<int, int>(0, -1), pair<int, int>(1, 0),
+                                      pair<int, int>(0, 1), pair<int, int>(-1, 0) };
+    unsigned long long checksum = 0;
+    for(int p = 0; p < passes; p++) {
+        for(size_t s = 0; s < states.size(); s++) {
+            pair<int, int> zeroPos = scanNumPos(states[s], 0);
+            for(int i = 0; i < 4; i++) {
+                pair<int, int> adjPos(zeroPos.first + adjacentArr[i].first, zeroPos.second + adjacentArr[i].second);
+                if(adjPos.first < 0 || adjPos.first >= 3 || adjPos.second < 0 || adjPos.second >= 3) continue;
+                Node child = states[s];
+                nodeNumSwap(child, zeroPos, adjPos);
+                checksum += child.state[zeroPos.first][zeroPos.second];
+            }
+        }
+    }
+    return checksum;
+}
+
+// =============================================
+// What the Node based modes do: Node + move table
+// =============================================
+static unsigned long long tableKernel(const vector<Node> &states, int passes) {
+    Node children[4];
+    unsigned long long checksum = 0;
+    for(int p = 0; p < passes; p++) {
+        for(size_t s = 0; s < states.size(); s++) {
+            int count = generateChildren(states[s], children);
+            int blank = states[s].pos[0];
+            for(int i = 0; i < count; i++) checksum += children[i].state[blank % SIDE][blank / SIDE];
+        }
+    }
+    return checksum;
+}
+
+// ======================
+// Packed state kernels
+// ======================
+static unsigned long long packedKernel(const vector<unsigned long long> &states, const vector<unsigned char> &blanks,
+                                       int passes) {
+    PackedChild children[4];
+    unsigned long long checksum = 0;
+    for(int p = 0; p < passes; p++) {
+        for(size_t s = 0; s < states.size(); s++) {
+            int count = packedChildren<SIDE>(states[s], blanks[s], children);
+            for(int i = 0; i < count; i++) checksum += children[i].tile;
+        }
+    }
+    return checksum;
+}
+
+// ==========================================================================
+// Every kernel generates the same children, so the checksums have to agree
+// (and using them stops the compiler throwing the loops away)
+// ==========================================================================
+void benchKernels(int passes, ostream &out) {
+    if(passes < 1) passes = 1;
+    
+    // Random walk from the goal, so every state is solvable and the blank
+    // visits corners, edges and the middle about as often as a search would
+    vector<Node> nodes;
+    vector<unsigned long long> packed;
+    vector<unsigned char> blanks;
+    Node curr = goalNode();
+    Node children[4];
+    srand(1);
+    for(int s = 0; s < BENCH_STATES; s++) {
+        nodes.push_back(curr);
+        packed.push_back(packState(curr));
+        blanks.push_back(curr.pos[0]);
+        int count = generateChildren(curr, children);
+        curr = children[rand() % count];
+    }
+    unsigned long long totalChildren = 0;
+    for(int s = 0; s < BENCH_STATES; s++) totalChildren += moveTable<SIDE>().count[blanks[s]];
+    totalChildren *= passes;
+    
+    out << "SUCCESSOR KERNELS (" << BENCH_STATES << " states x " << passes << " passes, "
+        << totalChildren << " children each)" << endl;
+    char line[128];
+    snprintf(line, sizeof(line), "%-24s %12s %14s %10s", "Kernel", "seconds", "children/sec", "speedup");
+    out << line << endl;
+    
+    const char *names[3] = { "Node + nodeNumSwap", "Node + move table", "Packed bitboard" };
+    double seconds[3];
+    unsigned long long checksums[3];
+    for(int k = 0; k < 3; k++) {
+        long long start = nowMicros();
+        if(k == 0) checksums[k] = swapKernel(nodes, passes);
+        else if(k == 1) checksums[k] = tableKernel(nodes, passes);
+        else checksums[k] = packedKernel(packed, blanks, passes);
+        seconds[k] = (nowMicros() - start) / 1e6;
+        if(seconds[k] <= 0) seconds[k] = 1e-6;
+        snprintf(line, sizeof(line), "%-24s %12.4f %14.0f %9.2fx", names[k], seconds[k],
+                 totalChildren / seconds[k], seconds[0] / seconds[k]);
+        out << line << endl;
+    }
+    if(checksums[0] != checksums[1] || checksums[0] != checksums[2]) {
+        out << "Kernels disagree! (checksums " << checksums[0] << ", " << checksums[1] << ", "
+            << checksums[2] << ")" << endl;
+    }
+    
+    // Manhattan distance of the same states: one Node at a time through
+    // heuristic(), then batches of packed states (scalar, then whatever
+    // batchHeuristic() picked for this CPU)
+    unsigned long long totalStates = (unsigned long long)BENCH_STATES * passes;
+    out << endl << "HEURISTIC KERNELS (Manhattan, " << totalStates << " states each)" << endl;
+    snprintf(line, sizeof(line), "%-24s %12s %14s %10s", "Kernel", "seconds", "states/sec", "speedup");
+    out << line << endl;
+    string batchName = string("Batch ") + batchKernelName();
+    const char *hNames[3] = { "heuristic()", "Batch scalar", batchName.c_str() };
+    vector<unsigned short> hn(BENCH_STATES);
+    for(int k = 0; k < 3; k++) {
+        long long start = nowMicros();
+        checksums[k] = 0;
+        for(int p = 0; p < passes; p++) {
+            if(k == 0) {
+                for(int s = 0; s < BENCH_STATES; s++) hn[s] = heuristic(nodes[s], 3);
+            }
+            else if(k == 1) batchHeuristicScalar(&packed[0], BENCH_STATES, 3, &hn[0]);
+            else batchHeuristic(&packed[0], BENCH_STATES, 3, &hn[0]);
+            checksums[k] += hn[p % BENCH_STATES];
+        }
+        for(int s = 0; s < BENCH_STATES; s++) checksums[k] += hn[s];
+        seconds[k] = (nowMicros() - start) / 1e6;
+        if(seconds[k] <= 0) seconds[k] = 1e-6;
+        snprintf(line, sizeof(line), "%-24s %12.4f %14.0f %9.2fx", hNames[k], seconds[k],
+                 totalStates / seconds[k], seconds[0] / seconds[k]);
+        out << line << endl;
+    }
+    if(checksums[0] != checksums[1] || checksums[0] != checksums[2]) {
+        out << "Heuristic kernels disagree! (checksums " << checksums[0] << ", " << checksums[1] << ", "
+            << checksums[2] << ")" << endl;
+    }
+}
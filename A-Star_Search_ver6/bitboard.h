@@ -0,0 +1,54 @@
+/* 
+ * File:   bitboard.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Successor generation straight on packed states (see packState())
+// A 3x3 board takes 36 bits and a 4x4 one exactly 64, so a whole board is
+// one integer. The blank's nibble is always 0, which makes a slide a pair
+// of XORs: clear the tile out of its cell and drop it into the blank's.
+// Which cells are next to the blank comes from moveTable(), so there are
+// no bounds checks and no branches inside a move.
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <ostream>
+#include "moves.h"
+
+// One child of a packed state
+struct PackedChild {
+    unsigned long long state;
+    unsigned char blank;        // Cell the blank moved to
+    unsigned char tile;         // Tile that slid, for heuristicDelta()
+};
+
+// Tile in a cell of a packed state
+inline int packedTile(unsigned long long packed, int cell) {
+    return (packed >> (4*cell)) & 0xF;
+}
+
+// Fill children with every state one slide away from packed, in the move
+// tables' order, and return how many there are. blank is the blank's cell
+template <int N>
+inline int packedChildren(unsigned long long packed, int blank, PackedChild children[4]) {
+    const MoveTable<N> &moves = moveTable<N>();
+    int count = moves.count[blank];
+    for(int i = 0; i < count; i++) {
+        int cell = moves.target[blank][i];
+        unsigned long long tile = (packed >> (4*cell)) & 0xF;
+        children[i].state = packed ^ (tile << (4*cell)) ^ (tile << (4*blank));
+        children[i].blank = cell;
+        children[i].tile = tile;
+    }
+    return count;
+}
+
+// Time the Node based successor generation against packedChildren(), and
+// heuristic() against batchHeuristic(), on states from a random walk,
+// passes times over each, and print the throughput of each
+void benchKernels(int passes, std::ostream &out);
+
+#endif /* BITBOARD_H */
@@ -0,0 +1,178 @@
+/* 
+ * File:   eightpuzzle.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <cstring>
+#include <new>
+#include "ara.h"
+#include "batch.h"
+#include "beam.h"
+#include "bfhs.h"
+#include "eightpuzzle.h"
+#include "frontier.h"
+#include "ida.h"
+#include "lrta.h"
+#include "moves.h"
+#include "output.h"
+#include "resultcache.h"
+#include "sma.h"
+#include "solver.h"
+using namespace std;
+
+const char *const modeNames[] = { "astar", "sma", "ara", "beam", "lrta", "ida", "frontier", "bfhs" };
+const int MODE_COUNT = sizeof(modeNames) / sizeof(modeNames[0]);
+
+bool knownMode(const char *mode) {
+    for(int i = 0; i < MODE_COUNT; i++) {
+        if(strcmp(mode, modeNames[i]) == 0) return true;
+    }
+    return false;
+}
+
+// ===========================================================================
+// Turn a board into a packed state, or say what's wrong with it
+// ===========================================================================
+static bool packBoard(const vector<int> &board, unsigned long long &packed, string &error) {
+    int cells = board.size();
+    if(cells != 9 && cells != 16) {
+        error = "board needs 9 or 16 tiles";
+        return false;
+    }
+    unsigned int seen = 0;
+    packed = 0;
+    for(int i = 0; i < cells; i++) {
+        if(board[i] < 0 || board[i] >= cells) {
+            error = "tile " + to_string(board[i]) + " is out of range";
+            return false;
+        }
+        if(seen & (1u << board[i])) {
+            error = "tile " + to_string(board[i]) + " appears twice";
+            return false;
+        }
+        seen |= 1u << board[i];
+        packed |= (unsigned long long)board[i] << (4*i);
+    }
+    return true;
+}
+
+// ===========================================================================
+// Replay blank moves (moveString() letters) from start, every board on the
+// way goes in path
+// ===========================================================================
+static void followMoves(unsigned long long start, const string &moves, int side, vector<unsigned long long> &path) {
+    const char names[] = "URDL";
+    int blank = 0;
+    while((start >> (4*blank)) & 0xF) blank++;
+    path.assign(1, start);
+    for(size_t i = 0; i < moves.size(); i++) {
+        int d = strchr(names, moves[i]) - names;
+        int cell = blank + BLANK_DY[d]*side + BLANK_DX[d];
+        unsigned long long tile = (path.back() >> (4*cell)) & 0xF;
+        path.push_back(path.back() ^ (tile << (4*cell)) ^ (tile << (4*blank)));
+        blank = cell;
+    }
+}
+
+// ===========================================================================
+// Run options.search.mode from start, a board solve() already checked.
+// out.path gets the solution (packed, start first) whichever mode it was
+// ===========================================================================
+static void runSearch(unsigned long long start, int side, const SolveOptions &options, SolveResult &out) {
+    const ModeOptions &search = options.search;
+    const short algorithm = options.algorithm;
+    if(strcmp(search.mode, "astar") == 0) {
+        thread_local Solver pruned(true), unpruned(false);
+        Solver &solver = options.solver ? *options.solver : options.movePruning ? pruned : unpruned;
+        out.stats = solver.solve(start, algorithm, options.budget, out.path, options.observer);
+        // Whoever cancelled wants the memory back, not kept for next time
+        if(out.stats.status == CANCELLED) solver.release();
+    }
+    else if(strcmp(search.mode, "bfhs") == 0) {
+        out.stats = bfhsPacked(start, side, algorithm, options.budget, out.path);
+    }
+    else {
+        Node initial = unpackState(start);
+        initial.hn = heuristic(initial, algorithm);
+        vector<Node> solution;
+        const char *mode = search.mode;
+        if(strcmp(mode, "sma") == 0) out.stats = smaStar(initial, algorithm, search.nodeCap, options.budget, solution);
+        else if(strcmp(mode, "ara") == 0) {
+            out.stats = araStar(initial, algorithm, search.weight, search.weightStep, options.budget, solution,
+                                options.observer);
+        }
+        else if(strcmp(mode, "beam") == 0) {
+            out.stats = beamSearch(initial, algorithm, search.beamWidth, options.budget, solution);
+        }
+        else if(strcmp(mode, "lrta") == 0) {
+            out.stats = lrtaStar(initial, algorithm, search.lookahead, search.moveTime, options.budget, solution);
+        }
+        else if(strcmp(mode, "ida") == 0) out.stats = idaStar(initial, algorithm, search.ttSize, options.budget, solution);
+        else if(strcmp(mode, "frontier") == 0) out.stats = frontierSearch(initial, algorithm, options.budget, solution);
+        for(size_t i = 0; i < solution.size(); i++) out.path.push_back(packState(solution[i]));
+    }
+}
+
+// ===========================================================================
+// The one place a mode name turns into a search, the command line included.
+// Plain A* keeps one Solver per thread and per pruning setting, so a thread
+// that calls this over and over stops allocating once it's warmed up
+// ===========================================================================
+SolveResult solve(const vector<int> &board, const SolveOptions &options) {
+    SolveResult out;
+    const ModeOptions &search = options.search;
+    unsigned long long start;
+    if(!packBoard(board, start, out.error)) return out;
+    int side = board.size() == 16 ? 4 : 3;
+    if(options.algorithm < 1 || options.algorithm > 3) {
+        out.error = "algorithm must be 1, 2 or 3";
+        return out;
+    }
+    if(!knownMode(search.mode)) {
+        out.error = string("unknown search mode ") + search.mode;
+        return out;
+    }
+    if(side != 3 && strcmp(search.mode, "bfhs") != 0) {
+        out.error = "only bfhs handles 4x4 boards";
+        return out;
+    }
+    if(!isSolvable(start, side)) return out;
+    
+    ResultCache *cache = options.cache && options.cache->boardSide() == side ? options.cache : NULL;
+    if(cache && !cache->claim(string(search.mode) + "/" + to_string(options.algorithm))) {
+        out.error = "the cache belongs to another search mode or heuristic";
+        return out;
+    }
+    CachedSolution cached;
+    if(cache && cache->lookup(start, cached)) {
+        out.stats.status = SOLVED;
+        out.stats.depth = out.stats.lowerBound = cached.depth;
+        out.moves = cached.moves;
+        followMoves(start, out.moves, side, out.path);
+        return out;
+    }
+    
+    // Running out of memory for real is just another way of going over budget
+    try {
+        runSearch(start, side, options, out);
+    }
+    catch(const bad_alloc &) {
+        out.stats.status = MEMORY_EXCEEDED;
+        out.path.clear();
+    }
+    if(out.stats.status == SOLVED) out.moves = moveString(out.path, side);
+    else out.path.clear();
+    // Only proven shortest answers go in the cache, a hit claims its depth is
+    // optimal. That leaves out searches that ran out of budget, LRTA* and
+    // beam search (beam search has no moves to follow either), and ARA*
+    // stopped before its weight got down to 1
+    if(cache && out.stats.status == SOLVED && out.stats.lowerBound == out.stats.depth
+       && out.moves.size() == out.stats.depth) {
+        cached.depth = out.stats.depth;
+        cached.moves = out.moves;
+        cache->store(start, cached);
+    }
+    return out;
+}
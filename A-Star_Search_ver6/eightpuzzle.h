@@ -0,0 +1,78 @@
+/* 
+ * File:   eightpuzzle.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// The solver as a library
+// Everything a program needs to solve boards without going through main():
+// hand solve() a board and some options, get back the moves, the depth and
+// the search stats. Nothing in here reads cin or writes cout, and nothing
+// touches main.cpp's globals, so solve() can be called from any number of
+// threads at once. The command line goes through solve() as well, its
+// tracing and recording hook in through SolveOptions::observer and its
+// progress through SearchBudget::counters. Plain A* runs through one Solver
+// per thread that's kept between calls (see solver.h).
+// The build puts this and the search modes in libeightpuzzle.a next to the
+// program, link against that and include this header.
+
+#ifndef EIGHTPUZZLE_H
+#define EIGHTPUZZLE_H
+
+#include <string>
+#include <vector>
+#include "puzzle.h"
+
+class ResultCache;
+class Solver;
+
+// Which search to run and the settings of the ones that have any
+struct ModeOptions {
+    const char *mode;       // One of modeNames
+    unsigned long long nodeCap;     // sma
+    double weight, weightStep;      // ara
+    unsigned long long beamWidth;   // beam
+    int lookahead;                  // lrta
+    double moveTime;                // lrta, milliseconds per move
+    unsigned long long ttSize;      // ida, megabytes of transposition table
+    
+    ModeOptions() : mode("astar"), nodeCap(100000), weight(3), weightStep(0.5), beamWidth(1000), lookahead(8),
+                    moveTime(5), ttSize(16) {}
+};
+extern const char *const modeNames[];
+extern const int MODE_COUNT;
+
+// Everything solve() needs besides the board
+struct SolveOptions {
+    short algorithm;        // 1 = uniform cost, 2 = misplaced tiles, 3 = Manhattan distance
+    ModeOptions search;
+    SearchBudget budget;
+    bool movePruning;       // Only plain A* looks at this
+    ResultCache *cache;     // Answer repeated boards from here (resultcache.h), NULL for no cache
+    SearchObserver *observer;   // Hooks for plain A* and ARA* (puzzle.h), NULL for none
+    Solver *solver;         // Plain A* runs on this one (with its own pruning setting), NULL for the thread's
+    
+    SolveOptions() : algorithm(3), movePruning(true), cache(NULL), observer(NULL), solver(NULL) {}
+};
+
+// What solve() found
+struct SolveResult {
+    SearchResult stats;     // Status, depth, expansions, time etc.
+    std::string moves;      // Blank moves (U/R/D/L, see output.h), only when solved
+    std::vector<unsigned long long> path;   // Packed boards, 4 bits a tile in reading order, start first
+    std::string error;      // Why the board or options were turned down, empty if they weren't
+};
+
+// Whether mode is one of modeNames
+bool knownMode(const char *mode);
+
+// Solve a board given in reading order, 0 for the blank. 9 tiles for 3x3,
+// or 16 for 4x4 (bfhs only). A board that's fine but can't reach the goal
+// comes back NO_SOLUTION without being searched, a bad board or bad options
+// come back NO_SOLUTION with error filled in, so does a cache some other
+// mode or heuristic is using. A board found in options.cache comes back
+// SOLVED with no expansions
+SolveResult solve(const std::vector<int> &board, const SolveOptions &options = SolveOptions());
+
+#endif /* EIGHTPUZZLE_H */
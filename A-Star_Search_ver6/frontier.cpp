@@ -0,0 +1,217 @@
+/* 
+ * File:   frontier.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <unordered_map>
+#include "frontier.h"
+#include "heap.h"
+#include "moves.h"
+#include "util.h"
+using namespace std;
+
+// Open node: the board, the moves that lead back into the closed part of
+// the search, and the board its path went through at the relay depth
+struct FrontierEntry {
+    Node node;
+    unsigned char used;             // Bit d set: blank move d goes to an expanded board
+    unsigned long long relay;       // Packed board at the relay depth, 0 until the path gets there
+};
+
+// Orders handles like cmpClass, f(n) then deeper first
+class FrontierBefore {
+    public:
+    explicit FrontierBefore(const vector<FrontierEntry> *entries) : entries(entries) {}
+    bool operator()(int lhs, int rhs) const {
+        return cmpClass()((*entries)[rhs].node, (*entries)[lhs].node);
+    }
+    private:
+    const vector<FrontierEntry> *entries;
+};
+
+class FrontierSearch {
+    public:
+    FrontierSearch(short algorithm, const SearchBudget &budget)
+        : algorithm(algorithm), budget(budget), startTime(nowMicros()), expansions(0), maxOpen(0), maxBytes(0),
+          status(WITHIN_BUDGET) {}
+    SearchResult run(const Node &start, vector<Node> &path);
+    
+    private:
+    bool search(const Node &from, const Node &to, unsigned long long relayDepth, unsigned long long &depth,
+                Node &relay);
+    bool solveSegment(const Node &from, const Node &to, unsigned long long depth, vector<Node> &path);
+    
+    short algorithm;
+    const SearchBudget &budget;
+    long long startTime;
+    unsigned long long expansions;  // Over every search, halves included
+    unsigned long long maxOpen;
+    unsigned long long maxBytes;
+    SearchStatus status;            // Set when the budget stops a search
+};
+
+// ===========================================================================
+// One frontier A* from from to to. Returns false if the budget ran out (or
+// to can't be reached), otherwise depth gets the solution depth and relay
+// the board the solution passed through at relayDepth moves in
+// ===========================================================================
+bool FrontierSearch::search(const Node &from, const Node &to, unsigned long long relayDepth,
+                            unsigned long long &depth, Node &relay) {
+    const MoveTable<SIDE> &moves = moveTable<SIDE>();
+    unsigned long long target = packState(to);
+    vector<FrontierEntry> entries;
+    vector<int> freeHandles;
+    unordered_map<unsigned long long, int> handles;
+    FrontierBefore before(&entries);
+    IndexedHeap<FrontierBefore> open(before);
+    
+    FrontierEntry root;
+    root.node = from;
+    root.node.gn = 0;
+    root.node.hn = heuristicTo(from, to, algorithm);
+    root.used = 0;
+    root.relay = relayDepth == 0 ? packState(from) : 0;
+    entries.push_back(root);
+    handles[packState(from)] = 0;
+    open.push(0);
+    
+    while(!open.empty()) {
+        int handle = open.top();
+        open.pop();
+        FrontierEntry curr = entries[handle];
+        unsigned long long state = packState(curr.node);
+        handles.erase(state);
+        freeHandles.push_back(handle);
+        if(state == target) {
+            depth = curr.node.gn;
+            relay = unpackState(curr.relay);
+            return true;
+        }
+        
+        unsigned long long bytes = entries.capacity() * sizeof(FrontierEntry) + open.capacityBytes()
+                                 + handles.size() * (sizeof(unsigned long long) + sizeof(int) + 2*sizeof(void *));
+        maxBytes = max(maxBytes, bytes);
+        // No closed list, that's the whole point
+        publishCounters(budget, expansions, curr.node.gn + curr.node.hn, open.size(), 0);
+        status = checkBudget(budget, startTime, expansions, bytes);
+        if(status != WITHIN_BUDGET) return false;
+        expansions++;
+        
+        int blank = curr.node.pos[0];
+        for(int i = 0; i < moves.count[blank]; i++) {
+            int dir = moves.dir[blank][i];
+            if(curr.used & (1 << dir)) continue;
+            int cell = moves.target[blank][i];
+            int tile = curr.node.state[cell % SIDE][cell / SIDE];
+            
+            FrontierEntry child;
+            child.node = curr.node;
+            child.node.gn = curr.node.gn + 1;
+            child.node.state[blank % SIDE][blank / SIDE] = tile;
+            child.node.state[cell % SIDE][cell / SIDE] = 0;
+            child.node.pos[tile] = blank;
+            child.node.pos[0] = cell;
+            child.node.hn = heuristicTo(child.node, to, algorithm);
+            // Moving the blank back the other way returns to curr, which is closed now
+            child.used = 1 << ((dir + 2) % 4);
+            unsigned long long childState = packState(child.node);
+            child.relay = child.node.gn == relayDepth ? childState : curr.relay;
+            
+            unordered_map<unsigned long long, int>::iterator it = handles.find(childState);
+            if(it != handles.end()) {
+                // Already open: that copy can't go back to curr either, and
+                // takes this path if it's shorter
+                FrontierEntry &queued = entries[it->second];
+                queued.used |= child.used;
+                if(child.node.gn < queued.node.gn) {
+                    queued.node = child.node;
+                    queued.relay = child.relay;
+                    open.decreaseKey(it->second);
+                }
+                continue;
+            }
+            int childHandle;
+            if(!freeHandles.empty()) {
+                childHandle = freeHandles.back();
+                freeHandles.pop_back();
+                entries[childHandle] = child;
+            }
+            else {
+                childHandle = entries.size();
+                entries.push_back(child);
+            }
+            handles[childState] = childHandle;
+            open.push(childHandle);
+        }
+        maxOpen = max(maxOpen, (unsigned long long)open.size());
+    }
+    return false;
+}
+
+// ===========================================================================
+// Append the boards after from, up to and including to, which is known to be
+// depth moves away. Split at the middle and solve each half until the
+// pieces are single moves
+// ===========================================================================
+bool FrontierSearch::solveSegment(const Node &from, const Node &to, unsigned long long depth, vector<Node> &path) {
+    if(depth == 0) return true;
+    if(depth == 1) {
+        path.push_back(to);
+        return true;
+    }
+    unsigned long long half = depth / 2, found;
+    Node relay;
+    if(!search(from, to, half, found, relay)) return false;
+    return solveSegment(from, relay, half, path) && solveSegment(relay, to, depth - half, path);
+}
+
+SearchResult FrontierSearch::run(const Node &start, vector<Node> &path) {
+    SearchResult result;
+    Node goal = goalNode();
+    unsigned long long depth;
+    Node relay;
+    // Relay halfway down h(start), the real depth isn't known yet
+    unsigned long long relayDepth = max(1, heuristicTo(start, goal, algorithm) / 2);
+    
+    result.status = NO_SOLUTION;
+    if(testState(start, goal)) {
+        result.status = SOLVED;
+        path.assign(1, start);
+    }
+    else if(search(start, goal, relayDepth, depth, relay)) {
+        result.depth = depth;
+        result.lowerBound = depth;
+        result.status = SOLVED;
+        path.assign(1, start);
+        if(depth <= relayDepth) relay = goal;
+        if(!solveSegment(start, relay, min(depth, relayDepth), path)
+           || !solveSegment(relay, goal, depth - min(depth, relayDepth), path)) {
+            result.status = status;
+        }
+    }
+    else if(status != WITHIN_BUDGET) result.status = status;
+    
+    // g(n) along the path, the halves were each searched from 0
+    for(size_t i = 0; i < path.size(); i++) {
+        path[i].gn = i;
+        path[i].hn = heuristic(path[i], algorithm);
+        path[i].parent = (long long)i - 1;
+    }
+    result.expansions = expansions;
+    result.maxQueueSize = maxOpen;
+    result.memoryBytes = maxBytes;
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+// ===========================================================
+// Frontier A* from start to the goal, see frontier.h for details
+// ===========================================================
+SearchResult frontierSearch(const Node &start, const short algorithm, const SearchBudget &budget,
+                            vector<Node> &path) {
+    FrontierSearch search(algorithm, budget);
+    return search.run(start, path);
+}
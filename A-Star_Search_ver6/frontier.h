@@ -0,0 +1,28 @@
+/* 
+ * File:   frontier.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Frontier A* (Korf)
+// A* without the closed list. Every open node remembers which of its moves
+// lead back to a neighbour that has already been expanded (its "used"
+// moves), so expanding it never regenerates a closed board, and closed
+// boards can just be forgotten. Memory is the frontier only. Without the
+// closed list there's no parent chain to follow, so instead every node
+// carries the board its path went through at a middle depth (the relay).
+// Once the goal is found, the two halves start -> relay and relay -> goal
+// are solved the same way, recursively, until each piece is one move long.
+
+#ifndef FRONTIER_H
+#define FRONTIER_H
+
+#include <vector>
+#include "puzzle.h"
+
+// path gets the solution, start first, when the search succeeds
+SearchResult frontierSearch(const Node &start, const short algorithm, const SearchBudget &budget,
+                            std::vector<Node> &path);
+
+#endif /* FRONTIER_H */
@@ -0,0 +1,114 @@
+/* 
+ * File:   heap.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Indexed d-ary min-heap over integer handles
+// Unlike std::priority_queue it knows where every handle sits, so it can
+// tell whether a handle is queued and move it up after its key improves
+// (decrease-key). Keys live outside the heap: Before(a, b) says whether
+// handle a should come out before handle b. A 4-ary heap is shallower than
+// a binary one and its children share a cache line, which wins for the
+// push-heavy open lists searches have. Alloc is handed to both vectors, so
+// a caller that counts its allocations (Solver) can see these too.
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+template <class Before, int D = 4, class Alloc = std::allocator<int> >
+class IndexedHeap {
+    public:
+    explicit IndexedHeap(const Before &before = Before(), const Alloc &alloc = Alloc())
+        : heap(alloc), pos(alloc), before(before) {}
+    
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    int top() const { return heap[0]; }
+    bool contains(int handle) const {
+        return handle < (int)pos.size() && pos[handle] >= 0;
+    }
+    
+    void push(int handle) {
+        if(handle >= (int)pos.size()) pos.resize(handle + 1, -1);
+        pos[handle] = heap.size();
+        heap.push_back(handle);
+        siftUp(heap.size() - 1);
+    }
+    
+    void pop() {
+        pos[heap[0]] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if(heap.empty()) return;
+        heap[0] = last;
+        pos[last] = 0;
+        siftDown(0);
+    }
+    
+    // Call after the handle's key got better (it can only move towards the top)
+    void decreaseKey(int handle) { siftUp(pos[handle]); }
+    
+    // Empties the heap, keeps the memory
+    void clear() {
+        for(size_t i = 0; i < heap.size(); i++) pos[heap[i]] = -1;
+        heap.clear();
+    }
+    
+    // Empties the heap and forgets every handle in O(1), keeps the memory.
+    // Only for when the handles start over from 0 afterwards
+    void reset() {
+        heap.clear();
+        pos.clear();
+    }
+    
+    size_t capacityBytes() const {
+        return heap.capacity() * sizeof(int) + pos.capacity() * sizeof(int);
+    }
+    
+    private:
+    void place(size_t i, int handle) {
+        heap[i] = handle;
+        pos[handle] = i;
+    }
+    
+    void siftUp(size_t i) {
+        int handle = heap[i];
+        while(i > 0) {
+            size_t parent = (i - 1) / D;
+            if(!before(handle, heap[parent])) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, handle);
+    }
+    
+    void siftDown(size_t i) {
+        int handle = heap[i];
+        size_t n = heap.size();
+        while(true) {
+            size_t first = i * D + 1;
+            if(first >= n) break;
+            size_t best = first;
+            size_t last = first + D < n ? first + D : n;
+            for(size_t c = first + 1; c < last; c++) {
+                if(before(heap[c], heap[best])) best = c;
+            }
+            if(!before(heap[best], handle)) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, handle);
+    }
+    
+    std::vector<int, Alloc> heap;   // Handles in heap order
+    std::vector<int, Alloc> pos;    // Handle -> index in heap, -1 if not queued
+    Before before;
+};
+
+#endif /* HEAP_H */
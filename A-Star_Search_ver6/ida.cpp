@@ -0,0 +1,178 @@
+/* 
+ * File:   ida.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include "ida.h"
+#include "moves.h"
+#include "prune.h"
+#include "util.h"
+using namespace std;
+
+// dfs() results that aren't f(n) values
+const unsigned long long IDA_FOUND = ULLONG_MAX - 1;
+const unsigned long long IDA_STOPPED = ULLONG_MAX;
+
+// One transposition table slot, key 0 means empty (a packed board always
+// has a tile somewhere, so real keys never are)
+struct TableEntry {
+    unsigned long long key;     // Packed board, automaton state above bit 40
+    unsigned short bound;       // Lower bound on the moves left to the goal
+    unsigned char depth;        // Threshold - g(n) of the search that found it
+};
+
+class IdaSearch {
+    public:
+    IdaSearch(short algorithm, unsigned long long ttMegabytes, const SearchBudget &budget);
+    SearchResult run(const Node &start, vector<Node> &path);
+    
+    private:
+    unsigned long long dfs(vector<Node> &path, unsigned long long threshold);
+    TableEntry *slot(unsigned long long key);
+    
+    short algorithm;
+    const SearchBudget &budget;
+    vector<TableEntry> table;       // Size is a power of 2
+    unsigned long long used;        // Slots filled
+    Node goal;
+    long long startTime;
+    unsigned long long expansions;
+    SearchStatus status;            // Set when the budget stops the search
+};
+
+IdaSearch::IdaSearch(short algorithm, unsigned long long ttMegabytes, const SearchBudget &budget)
+    : algorithm(algorithm), budget(budget), used(0), startTime(0), expansions(0), status(WITHIN_BUDGET) {
+    unsigned long long slots = (ttMegabytes << 20) / sizeof(TableEntry);
+    unsigned long long size = 1;
+    while(size * 2 <= slots) size *= 2;
+    if(slots > 0) table.assign(size, TableEntry());
+}
+
+// Where a key lives, NULL without a table
+TableEntry *IdaSearch::slot(unsigned long long key) {
+    if(table.empty()) return NULL;
+    return &table[(key * 0x9E3779B97F4A7C15ULL >> 20) & (table.size() - 1)];
+}
+
+// ===========================================================================
+// Search below the last node of path, f(n) up to threshold. Returns
+// IDA_FOUND with the solution left in path, IDA_STOPPED if the budget ran
+// out, otherwise the smallest f(n) seen past the threshold
+// ===========================================================================
+unsigned long long IdaSearch::dfs(vector<Node> &path, unsigned long long threshold) {
+    const MoveTable<SIDE> &moves = moveTable<SIDE>();
+    const MovePruner &pruner = movePruner();
+    Node node = path.back();
+    
+    // Stored bound if it beats h(n)
+    unsigned long long key = packState(node) | (unsigned long long)node.fsm << 40;
+    TableEntry *entry = slot(key);
+    unsigned long long bound = node.hn;
+    if(entry && entry->key == key) bound = max(bound, (unsigned long long)entry->bound);
+    if(node.gn + bound > threshold) return node.gn + bound;
+    if(node.hn == 0 && testState(goal, node)) return IDA_FOUND;
+    
+    publishCounters(budget, expansions, threshold, path.size(), used);
+    status = checkBudget(budget, startTime, expansions, table.size() * sizeof(TableEntry)
+                         + path.capacity() * sizeof(Node));
+    if(status != WITHIN_BUDGET) return IDA_STOPPED;
+    expansions++;
+    
+    int blank = node.pos[0];
+    unsigned long long next = ULLONG_MAX - 2;
+    for(int i = 0; i < moves.count[blank]; i++) {
+        int fsm = pruner.next(node.fsm, moves.dir[blank][i]);
+        if(fsm < 0) continue;
+        int cell = moves.target[blank][i];
+        int tile = node.state[cell % SIDE][cell / SIDE];
+        
+        Node child = node;
+        child.gn = node.gn + 1;
+        child.state[blank % SIDE][blank / SIDE] = tile;
+        child.state[cell % SIDE][cell / SIDE] = 0;
+        child.pos[tile] = blank;
+        child.pos[0] = cell;
+        child.fsm = fsm;
+        child.hn = node.hn + heuristicDelta(algorithm, tile, blank, i);
+        child.parent = path.size() - 1;
+        
+        path.push_back(child);
+        unsigned long long result = dfs(path, threshold);
+        if(result == IDA_FOUND || result == IDA_STOPPED) return result;
+        path.pop_back();
+        next = min(next, result);
+    }
+    
+    // Nothing under here gets to the goal within the threshold, so the goal
+    // is at least next - g(n) away. Keep that, unless the slot holds a board
+    // that was searched deeper
+    if(entry && next < ULLONG_MAX - 2) {
+        unsigned long long depth = min(threshold - node.gn, (unsigned long long)UCHAR_MAX);
+        unsigned long long learned = min(next - node.gn, (unsigned long long)USHRT_MAX);
+        if(entry->key == key) {
+            entry->bound = max((unsigned long long)entry->bound, learned);
+            entry->depth = max((unsigned long long)entry->depth, depth);
+        }
+        else if(entry->key == 0 || depth >= entry->depth) {
+            if(entry->key == 0) used++;
+            entry->key = key;
+            entry->bound = learned;
+            entry->depth = depth;
+        }
+    }
+    return next;
+}
+
+SearchResult IdaSearch::run(const Node &start, vector<Node> &path) {
+    SearchResult result;
+    startTime = nowMicros();
+    goal = goalNode();
+    
+    Node root = start;
+    root.gn = 0;
+    root.hn = heuristic(root, algorithm);
+    root.fsm = movePruner().start();
+    root.parent = -1;
+    unsigned long long threshold = root.hn;
+    result.status = NO_SOLUTION;
+    while(true) {
+        path.assign(1, root);
+        unsigned long long next = dfs(path, threshold);
+        if(next == IDA_FOUND) {
+            result.status = SOLVED;
+            result.depth = path.back().gn;
+            result.lowerBound = result.depth;
+            break;
+        }
+        result.lowerBound = threshold;
+        if(next == IDA_STOPPED) {
+            result.status = status;
+            path.clear();
+            break;
+        }
+        // Nothing went over the threshold, so there's nowhere left to look
+        if(next >= ULLONG_MAX - 2) {
+            path.clear();
+            break;
+        }
+        threshold = next;
+    }
+    result.expansions = expansions;
+    result.maxQueueSize = used;
+    result.memoryBytes = table.size() * sizeof(TableEntry) + path.capacity() * sizeof(Node);
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+// ======================================================
+// Iterative deepening from start, see ida.h for details
+// ======================================================
+SearchResult idaStar(const Node &start, const short algorithm, unsigned long long ttMegabytes,
+                     const SearchBudget &budget, vector<Node> &path) {
+    IdaSearch search(algorithm, ttMegabytes, budget);
+    return search.run(start, path);
+}
@@ -0,0 +1,30 @@
+/* 
+ * File:   ida.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// IDA* with a transposition table
+// Depth-first search to an f(n) threshold, raising the threshold to the
+// smallest f(n) that went over it until the goal turns up. Memory is just
+// the current path plus a fixed-size table: whenever a subtree fails, the
+// smallest f(n) found past the threshold minus g(n) is a better lower bound
+// for that board than h(n), so it's stored and used instead next time the
+// board comes up (in this iteration or a later one). The table is lossy: one
+// entry per slot, a new entry only replaces an old one that was backed by a
+// shallower search. Moves the pruning automaton forbids are never made, so
+// entries are per (board, automaton state), the subtree below depends on both.
+
+#ifndef IDA_H
+#define IDA_H
+
+#include <vector>
+#include "puzzle.h"
+
+// ttMegabytes of transposition table (0 for none), path gets the solution,
+// start first, when the search succeeds
+SearchResult idaStar(const Node &start, const short algorithm, unsigned long long ttMegabytes,
+                     const SearchBudget &budget, std::vector<Node> &path);
+
+#endif /* IDA_H */
@@ -0,0 +1,159 @@
+/* 
+ * File:   lrta.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include "lrta.h"
+#include "symmetry.h"
+#include "util.h"
+using namespace std;
+
+// Give up after this many moves if no budget says otherwise
+const unsigned long long LRTA_MAX_MOVES = 1000000;
+// Lookahead nodes between clock checks
+const unsigned long long LRTA_CLOCK_INTERVAL = 64;
+
+class LrtaAgent {
+    public:
+    LrtaAgent(short algorithm) : algorithm(algorithm), generated(0), deadline(0), limits(NULL), outOfTime(false) {}
+    SearchResult run(const Node &start, int maxDepth, double moveTimeMs, const SearchBudget &budget,
+                     vector<Node> &path);
+    
+    private:
+    unsigned long long learned(const Node &node, unsigned long long state);
+    unsigned long long lookahead(const Node &node, int depth);
+    
+    short algorithm;
+    // Learned h(n), canonicalState() -> value. A board and its mirror image are
+    // the same distance from the goal, so they share one entry
+    unordered_map<unsigned long long, unsigned long long> h;
+    Node goal;
+    unsigned long long generated;   // Lookahead nodes, counted as expansions
+    long long deadline;             // End of the current move's time (or the whole search's, if sooner)
+    const SearchBudget *limits;     // Only for its cancel flags
+    bool outOfTime;
+};
+
+// h(n) as learned so far, the heuristic if we haven't been here (or at its
+// mirror image) before. state is the canonical key
+unsigned long long LrtaAgent::learned(const Node &node, unsigned long long state) {
+    unordered_map<unsigned long long, unsigned long long>::iterator it = h.find(state);
+    return it == h.end() ? heuristic(node, algorithm) : it->second;
+}
+
+// ============================================================================
+// Cost to the goal as seen from depth moves ahead: 0 at the goal, learned h(n)
+// at the horizon, otherwise the best child plus one (or learned h(n), if
+// that's bigger). Stepping back to the
+// parent is allowed on purpose: skipping it would make the value an
+// overestimate, and learning from overestimates can trap the agent in a loop.
+// Bails out (the caller throws the answer away) once time is up or the
+// search is cancelled
+// ============================================================================
+unsigned long long LrtaAgent::lookahead(const Node &node, int depth) {
+    unsigned long long state = canonicalState(packState(node));
+    generated++;
+    if(testState(goal, node)) return 0;
+    if(depth == 0) return learned(node, state);
+    if(generated % LRTA_CLOCK_INTERVAL == 0) {
+        if(nowMicros() > deadline || budgetCancelled(*limits)) outOfTime = true;
+    }
+    if(outOfTime) return ULLONG_MAX;
+    
+    Node children[4];
+    int n = generateChildren(node, children);
+    unsigned long long best = ULLONG_MAX;
+    for(int c = 0; c < n; c++) {
+        unsigned long long value = lookahead(children[c], depth - 1);
+        if(value != ULLONG_MAX) best = min(best, value + 1);
+    }
+    // Both are lower bounds, so take the larger. Without this the values
+    // learned for boards inside the lookahead would never be seen and the
+    // agent could bounce between two boards forever
+    unsigned long long known = learned(node, state);
+    return best == ULLONG_MAX ? known : max(best, known);
+}
+
+// ==========================================================================
+// One move at a time: deepen the lookahead from each neighbour while time
+// allows (depth 1 always finishes), raise h(current) to the best neighbour's
+// value plus one, then move to that neighbour
+// ==========================================================================
+SearchResult LrtaAgent::run(const Node &start, int maxDepth, double moveTimeMs, const SearchBudget &budget,
+                            vector<Node> &path) {
+    SearchResult result;
+    long long startTime = nowMicros();
+    goal = goalNode();
+    if(maxDepth < 1) maxDepth = 1;
+    
+    Node curr = start;
+    curr.hn = heuristic(curr, algorithm);
+    result.lowerBound = curr.hn;
+    path.assign(1, curr);
+    result.status = NO_SOLUTION;
+    limits = &budget;
+    // No lookahead may run past the whole search's time limit either
+    long long searchEnd = budget.timeLimitMs ? startTime + (long long)budget.timeLimitMs * 1000 : 0;
+    
+    for(unsigned long long moves = 0; moves < LRTA_MAX_MOVES; moves++) {
+        if(testState(goal, curr)) {
+            result.status = SOLVED;
+            result.depth = moves;
+            break;
+        }
+        // Once a move, and generated jumps by a whole lookahead, so every check every time
+        SearchStatus status = checkBudgetNow(budget, startTime, generated,
+                                             h.size() * 4 * sizeof(unsigned long long));
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            break;
+        }
+        
+        unsigned long long state = canonicalState(packState(curr));
+        publishCounters(budget, generated, moves + learned(curr, state), 0, h.size());
+        Node children[4];
+        unsigned long long values[4], attempt[4];
+        int n = generateChildren(curr, children);
+        deadline = nowMicros() + (long long)(moveTimeMs * 1000);
+        if(searchEnd && searchEnd < deadline) deadline = searchEnd;
+        for(int depth = 0; depth < maxDepth; depth++) {
+            outOfTime = false;
+            for(int c = 0; c < n; c++) attempt[c] = lookahead(children[c], depth);
+            // Only a fully finished lookahead depth gets used (the first one always is)
+            if(outOfTime && depth > 0) break;
+            for(int c = 0; c < n; c++) values[c] = attempt[c];
+            if(nowMicros() > deadline) break;
+        }
+        
+        int best = 0;
+        for(int c = 1; c < n; c++) {
+            if(values[c] < values[best]) best = c;
+        }
+        // Learning step, h(n) only ever goes up
+        unsigned long long updated = values[best] + 1;
+        if(updated > learned(curr, state)) h[state] = updated;
+        
+        curr = children[best];
+        curr.hn = min(values[best], (unsigned long long)USHRT_MAX);
+        path.push_back(curr);
+    }
+    result.expansions = generated;
+    result.maxQueueSize = h.size();
+    result.memoryBytes = h.size() * 4 * sizeof(unsigned long long);
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+// ===============================================
+// Walk from start to the goal one move at a time
+// ===============================================
+SearchResult lrtaStar(const Node &start, const short algorithm, int maxDepth, double moveTimeMs,
+                      const SearchBudget &budget, vector<Node> &path) {
+    LrtaAgent agent(algorithm);
+    return agent.run(start, maxDepth, moveTimeMs, budget, path);
+}
@@ -0,0 +1,27 @@
+/* 
+ * File:   lrta.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Real-time search (LRTA*)
+// Instead of planning the whole solution, look a few moves ahead of the
+// current board, commit the single best move, and repeat. Each move costs
+// a bounded lookahead (deepened one level at a time until either maxDepth
+// or the per-move time budget is reached), so move latency doesn't depend on
+// how hard the puzzle is. h(n) values learned along the way are kept in a
+// hash table, which is what stops the agent from going around in circles.
+// Solutions are usually longer than optimal.
+
+#ifndef LRTA_H
+#define LRTA_H
+
+#include <vector>
+#include "puzzle.h"
+
+// path gets every board the agent moved through, start first
+SearchResult lrtaStar(const Node &start, const short algorithm, int maxDepth, double moveTimeMs,
+                      const SearchBudget &budget, std::vector<Node> &path);
+
+#endif /* LRTA_H */
@@ -15,42 +15,109 @@
 #include <cstdlib>
 #include <iostream>
 #include <vector>
-#include <algorithm>
-#include <queue>
 #include <ctime>
+#include <cstring>
+#include <string>
+#include <deque>
+#include <future>
+#include "analysis.h"
+#include "batch.h"
+#include "bitboard.h"
+#include "eightpuzzle.h"
+#include "output.h"
+#include "progress.h"
+#include "puzzle.h"
+#include "recorder.h"
+#include "resultcache.h"
+#include "solvepool.h"
+#include "solver.h"
+#include "trace.h"
+#include "util.h"
 using namespace std;
 
 // Global Variables
-int maxQSize = 0;
-
-// Structures
-// State node
-struct Node {
-    short state[3][3];   // Puzzle grid, 0 represents the blank space
-    // gn = depth = path cost
-    // hn = hueristic distance to goal
-    unsigned long long int gn; 
-    unsigned short hn;
-};
-// Custom comparison class to sort by g(n) + h(n) in priority queue
-class cmpClass {
-    public:
-    bool operator()(const Node &lhs, const Node &rhs) {
-        return (lhs.gn + lhs.hn) > (rhs.gn + rhs.hn);
-    }
-};
+// Only the command line uses these, solve() (eightpuzzle.h) never looks at them
+TraceWriter *tracer = NULL;     // Only set when --trace is given
+ExpansionRecorder *recorder = NULL; // Only set when --record is given
+SearchCounters counters;        // Sampled by the --progress reporter thread
+bool quiet = false;             // Skip printing every expanded node
+bool movePruning = true;        // Skip moves the pruning automaton forbids (undo moves in A*, prune.h)
+const int TRACE_SAMPLE = 64;    // Expansions between queue/memory samples in the trace
 
 // Function prototypes
 // MAIN FUNCTIONS
-bool aStar(priority_queue<Node, vector<Node>, cmpClass>&, vector<Node>&, const short);
-int heuristic(Node, const short);
-bool testState(const Node &, const Node &);
-void expand(priority_queue<Node, vector<Node>, cmpClass>&, vector<Node>&, const short);
 
 // HELPER FUNCTIONS
-pair<int, int> findNumPos(const Node &, int);
-void nodeNumSwap(Node &, pair<int, int>, pair<int, int>);
+int readLog(const char *);
+int solveLarge(int, const short, const SearchBudget &);
+int solveBatch(const char *, const ModeOptions &, const short, const SearchBudget &, const char *, bool, int,
+               ResultCache *);
+void solvePooled(const BatchInput &, const SolveOptions &, int, ResultWriter &, unsigned long long &,
+                 unsigned long long &);
 void displayNode(const Node);
+
+// ===========================================================================
+// Everything the command line hangs on a search: the node by node printout,
+// the trace, the expansion log and the states --analyze looks at. The
+// search itself runs in the library (solve()), this only watches it
+// ===========================================================================
+class CommandLineObserver : public SearchObserver {
+    public:
+    explicit CommandLineObserver(bool keepStates) : keepStates(keepStates), expansions(0) {}
+    
+    void discovered(const Node &node, long long) {
+        if(keepStates) reached.push_back(node);
+    }
+    
+    void expanding(const Node &node, long long id, long long parent, unsigned long long open,
+                   unsigned long long closed) {
+        if(tracer) {
+            if(expansions > 0) tracer->end("expand");
+            if(expansions % TRACE_SAMPLE == 0) {
+                tracer->counter("open", open);
+                tracer->counter("closed", closed);
+                tracer->counter("rss_kb", currentRSS() / 1024);
+            }
+            tracer->begin("expand");
+        }
+        if(!quiet) {
+            cout << "Expanding node with g(n) = " << node.gn << " and h(n) = " << node.hn << ": " << endl;
+            // Demonstrative output
+            displayNode(node);
+        }
+        if(recorder) {
+            // The log numbers nodes in expansion order, the search in the
+            // order it found them
+            if(id >= (long long)logIds.size()) logIds.resize(id + 1, -1);
+            logIds[id] = expansions;
+            recorder->record(packState(node), node.gn, node.hn, parent < 0 ? -1 : logIds[parent]);
+        }
+        expansions++;
+    }
+    
+    void newBound(unsigned long long fBound) {
+        if(tracer) tracer->instant("f-bound", "f", fBound);
+    }
+    
+    // Print each improved solution the anytime search finds as it goes
+    void improved(const vector<Node> &path, double bound) {
+        if(quiet) return;
+        cout << "Found a solution of depth " << path.size()-1 << ", at most " << bound
+             << " times the optimal depth" << endl;
+    }
+    
+    // Closes the last expansion's span once the search is over
+    void finish() {
+        if(tracer && expansions > 0) tracer->end("expand");
+    }
+    
+    vector<Node> reached;           // Every state A* found, with keepStates
+    
+    private:
+    bool keepStates;
+    unsigned long long expansions;
+    vector<long long> logIds;       // Search id -> expansion log id
+};
 /*
  * 
  */
@@ -60,6 +127,98 @@ int main(int argc, char** argv) {
     // Algorithm variable
     short algorithm;
     
+    // Command line options
+    // --trace <file>     write a trace-event JSON timeline of the search (Perfetto / chrome://tracing)
+    // --record <file>    write a binary log of every expanded node (see recorder.h)
+    // --read-log <file>  print a log written by --record and exit
+    // --progress <ms>    report search progress every <ms> milliseconds on stderr
+    // --stats-file <f>   write the progress reports to a CSV file instead
+    // --quiet            don't print every node as it is expanded
+    // --analyze <n>      compare all heuristics against the true distance on n
+    //                    sampled states from the search (0 = every state)
+    // --time-limit <ms>  give up after this many milliseconds
+    // --max-expansions <n>   give up after expanding this many nodes
+    // --max-memory <MB>  give up once the search holds this much node memory
+    // --search <mode>    astar (default), sma, ara, beam, lrta, ida, frontier or bfhs
+    // --node-cap <n>     most nodes SMA* may hold at once (default 100000)
+    // --weight <w>       starting weight on h(n) for ARA* (default 3)
+    // --weight-step <d>  how much ARA* lowers the weight after each solution (default 0.5)
+    // --beam-width <w>   nodes kept per layer by beam search (default 1000)
+    // --lookahead <d>    deepest lookahead per move for LRTA* (default 8)
+    // --move-time <ms>   time LRTA* may spend on each move (default 5)
+    // --tt-size <MB>     transposition table size for IDA* (default 16, 0 for none)
+    // --side <n>         board size, 3 (default) or 4. 4x4 boards only work with bfhs
+    // --moves-file <f>   also write the solution's moves to a file (see output.h)
+    // --binary-moves     write that file 2 bits per move instead of as text
+    // --no-move-pruning  generate every move, even ones known to lead to duplicates
+    // --bench-kernels <n>  time the successor generation kernels over n passes and exit
+    // --batch <file>     solve every board in a file (see batch.h), moves go to --moves-file
+    // --threads <n>      solve the batch on n threads (see solvepool.h), 0 for one per core
+    // --cache <n>        remember the last n solved batch boards (see resultcache.h)
+    // --cache-symmetry   let a board and its mirror image share a cache entry
+    const char *traceFile = NULL;
+    const char *recordFile = NULL;
+    const char *statsFile = "";
+    int progressMs = 0;
+    int analyzeSamples = -1;
+    SearchBudget budget;
+    ModeOptions options;
+    int side = 3;
+    const char *batchFile = NULL;
+    const char *movesFile = NULL;
+    bool binaryMoves = false;
+    int threads = -1;
+    size_t cacheEntries = 0;
+    bool cacheSymmetry = false;
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--trace") == 0 && i+1 < argc) traceFile = argv[++i];
+        else if(strcmp(argv[i], "--record") == 0 && i+1 < argc) recordFile = argv[++i];
+        else if(strcmp(argv[i], "--read-log") == 0 && i+1 < argc) return readLog(argv[++i]);
+        else if(strcmp(argv[i], "--bench-kernels") == 0 && i+1 < argc) {
+            benchKernels(atoi(argv[++i]), cout);
+            return 0;
+        }
+        else if(strcmp(argv[i], "--progress") == 0 && i+1 < argc) progressMs = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--stats-file") == 0 && i+1 < argc) statsFile = argv[++i];
+        else if(strcmp(argv[i], "--quiet") == 0) quiet = true;
+        else if(strcmp(argv[i], "--no-move-pruning") == 0) movePruning = false;
+        else if(strcmp(argv[i], "--analyze") == 0 && i+1 < argc) analyzeSamples = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--time-limit") == 0 && i+1 < argc) budget.timeLimitMs = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--max-expansions") == 0 && i+1 < argc) budget.maxExpansions = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--max-memory") == 0 && i+1 < argc) budget.maxMemoryBytes = strtoull(argv[++i], NULL, 10) << 20;
+        else if(strcmp(argv[i], "--search") == 0 && i+1 < argc) options.mode = argv[++i];
+        else if(strcmp(argv[i], "--node-cap") == 0 && i+1 < argc) options.nodeCap = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--weight") == 0 && i+1 < argc) options.weight = atof(argv[++i]);
+        else if(strcmp(argv[i], "--weight-step") == 0 && i+1 < argc) options.weightStep = atof(argv[++i]);
+        else if(strcmp(argv[i], "--beam-width") == 0 && i+1 < argc) options.beamWidth = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--lookahead") == 0 && i+1 < argc) options.lookahead = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--move-time") == 0 && i+1 < argc) options.moveTime = atof(argv[++i]);
+        else if(strcmp(argv[i], "--tt-size") == 0 && i+1 < argc) options.ttSize = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--batch") == 0 && i+1 < argc) batchFile = argv[++i];
+        else if(strcmp(argv[i], "--threads") == 0 && i+1 < argc) threads = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--cache") == 0 && i+1 < argc) cacheEntries = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--cache-symmetry") == 0) cacheSymmetry = true;
+        else if(strcmp(argv[i], "--side") == 0 && i+1 < argc) side = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--moves-file") == 0 && i+1 < argc) movesFile = argv[++i];
+        else if(strcmp(argv[i], "--binary-moves") == 0) binaryMoves = true;
+        else {
+            cout << "Unknown option: " << argv[i] << endl;
+            return 1;
+        }
+    }
+    if(!knownMode(options.mode)) {
+        cout << "Unknown search mode: " << options.mode << endl;
+        return 1;
+    }
+    if(traceFile) {
+        tracer = new TraceWriter(traceFile);
+        if(!tracer->isOpen()) cout << "Could not open trace file " << traceFile << endl;
+    }
+    if(recordFile) {
+        recorder = new ExpansionRecorder(recordFile, 3);
+        if(!recorder->isOpen()) cout << "Could not open record file " << recordFile << endl;
+    }
+    
     // Get algorithm choice from user
     cout << "Please enter a number for the algorithm you would like to use: " << endl;
     cout << "\'1\' - Uniform Cost Search" << endl;
@@ -67,226 +226,280 @@ int main(int argc, char** argv) {
     cout << "\'3\' - Manhattan Distance Heuristic" << endl;
     cin >> algorithm;
     cout << endl;
+    // Anything else ends up as uniform cost search
+    if(algorithm < 1 || algorithm > 3) {
+        cout << "Not a valid algorithm" << endl;
+        algorithm = 1;
+    }
+    if(side != 3) {
+        if(side != 4 || strcmp(options.mode, "bfhs") != 0) {
+            cout << "Only --search bfhs handles boards other than 3x3 (and only 4x4)" << endl;
+            return 1;
+        }
+        return solveLarge(side, algorithm, budget);
+    }
+    if(batchFile) {
+        ResultCache *cache = cacheEntries ? new ResultCache(cacheEntries, cacheSymmetry) : NULL;
+        int status = solveBatch(batchFile, options, algorithm, budget, movesFile, binaryMoves, threads, cache);
+        delete cache;
+        return status;
+    }
     
-    // Get input and initialize heuristics
+    // Get input
     cout << "Please enter the starting state of the puzzle from the top left number to the bottom ";
     cout << "right number, ie. \"1 2 3 4 5 6 7 8 0\"" << endl;
-    for(int y = 0; y < 3; y++) {
-        for(int x = 0; x < 3; x++) {
-            cin >> initial.state[x][y];
-        }
-    }
+    vector<int> board(CELLS, -1);
+    for(int i = 0; i < CELLS; i++) cin >> board[i];
     cout << endl;
-    initial.gn = 0;
-    initial.hn = heuristic(initial, algorithm);
+    for(int i = 0; i < CELLS; i++) initial.state[i % SIDE][i / SIDE] = board[i];
     
     // Output initial state as confirmation
     cout << "INITIAL STATE: " << endl;
     displayNode(initial);
+    // Output the goal state in case something goes horribly wrong
+    if(strcmp(options.mode, "astar") == 0 && !quiet) {
+        cout << "GOAL STATE: " << endl;
+        displayNode(goalNode());
+        cout << endl;
+    }
     
-    // Initialize queue and queue history
-    vector<Node> history;
-    priority_queue<Node, vector<Node>, cmpClass> q;
-    q.push(initial);
+    // solve() runs the search (and checks the board first), main only watches
+    SolveOptions solveOptions;
+    solveOptions.algorithm = algorithm;
+    solveOptions.search = options;
+    solveOptions.budget = budget;
+    solveOptions.movePruning = movePruning;
+    CommandLineObserver observer(analyzeSamples >= 0);
+    if(!quiet || tracer || recorder || analyzeSamples >= 0) solveOptions.observer = &observer;
+    
+    // A stats file on its own implies the default one second interval
+    ProgressReporter *reporter = NULL;
+    if(progressMs > 0 || *statsFile) {
+        reporter = new ProgressReporter(counters, progressMs, statsFile);
+        solveOptions.budget.counters = &counters;
+    }
     
     int start = time(0);
+    if(tracer) tracer->begin(options.mode);
+    SolveResult solved = solve(board, solveOptions);
+    observer.finish();
+    if(tracer) tracer->end(options.mode);
+    delete reporter;
+    if(!solved.error.empty()) {
+        cout << "Not a valid puzzle: " << solved.error << endl;
+        delete tracer;
+        delete recorder;
+        return 1;
+    }
+    SearchResult result = solved.stats;
     // If algorithm succeeded
-    if(aStar(q, history, algorithm)) {
+    if(result.status == SOLVED) {
         cout << endl << "Puzzle solved!" << endl;
         cout << "This should be the solved puzzle: " << endl;
-        displayNode(q.top());
+        displayNode(unpackState(solved.path.back()));
+    }
+    // If the search ran out of budget, say how far it got
+    else if(result.status != NO_SOLUTION) {
+        cout << endl << "Search stopped: " << statusName(result.status) << endl;
+        cout << "Solution depth is at least " << result.lowerBound << endl;
     }
     // If algorithm failed
     else cout << endl << "Failed to find solution" << endl;
     int stop = time(0);
     
+    const string &moves = solved.moves;
+    if(movesFile) {
+        ResultWriter writer(movesFile, binaryMoves);
+        if(!writer.isOpen()) cout << "Could not open moves file " << movesFile << endl;
+        writer.write(result, moves);
+    }
+    
     // Output nodes expanded and depth for statistics
-    cout << "Solution depth: " << q.top().gn << endl;
-    cout << "Nodes expanded: " << history.size()-1 << endl;
-    cout << "Maximum Node Queue Size: " << maxQSize << endl;
+    if(result.status == SOLVED) cout << "Solution depth: " << result.depth << endl;
+    if(result.status == SOLVED && moves.size() == result.depth) cout << "Solution moves: " << moves << endl;
+    // Anytime modes can be stopped before they prove their answer optimal
+    if(result.status == SOLVED && result.lowerBound < result.depth) {
+        cout << "Not proven optimal, optimal depth is at least " << result.lowerBound << endl;
+    }
+    cout << "Nodes expanded: " << result.expansions << endl;
+    cout << "Maximum Node Queue Size: " << result.maxQueueSize << endl;
     cout << "Time taken: " << stop - start << " seconds" << endl;
     
-    return 0;
-}
-
-// ================================================
-// This function holds the generic search algorithm
-// ================================================
-bool aStar(priority_queue<Node, vector<Node>, cmpClass> &q, vector<Node> &history, const short algorithm) {
-    // Initialize goal state
-    Node goal;
-    // Required internet consultation: https://stackoverflow.com/questions/30178879/how-can-i-assign-an-array-from-an-initializer-list
-    // (Not for code but for general C++ rules)
-    int arr[9] = { 1, 2, 3, 4, 5, 6, 7, 8, 0 };
-    for(int y = 0; y < 3; y++) {
-        for(int x = 0; x < 3; x++) {
-            goal.state[x][y] = arr[(y*3)+x];
+    // States the search reached: everything A* found (expanded or still
+    // queued), or just the solution path for the other modes
+    if(analyzeSamples >= 0) {
+        vector<Node> &reached = observer.reached;
+        if(strcmp(options.mode, "astar") != 0) {
+            for(size_t i = 0; i < solved.path.size(); i++) reached.push_back(unpackState(solved.path[i]));
         }
+        syncPositions(initial);
+        analyzeHeuristics(reached, initial, analyzeSamples, cout);
     }
-    // Output the goal state in case something goes horribly wrong
-    cout << "GOAL STATE: " << endl;
-    displayNode(goal);
-    cout << endl;
-    goal.hn = goal.gn = 0;
     
-    // While loop
-    while(!q.empty()) {
-        if(q.size() > maxQSize) maxQSize = q.size();
-        // Test if the new front-most node is the goal state
-        if(testState(goal, q.top()) && q.top().hn == 0) return true;
-        // Expand the current node and pop
-        cout << "Expanding node with g(n) = " << q.top().gn << " and h(n) = " << q.top().hn << ": " << endl;
-        // Demonstrative output
-        displayNode(q.top());
-        expand(q, history, algorithm);
-    }
-    return false;
+    // Flushes the rest of the trace and expansion log
+    delete tracer;
+    delete recorder;
+    return 0;
 }
 
-// =======================================================================
-// THE ONLY FUNCTION THAT SHOULD CHANGE BETWEEN ALL 3 VERSIONS OF THE CODE
-// This code calculates the h(n) of a particular node
-// Version 1: Uniform Cost Search - always returns 0
-// Version 2: Misplaced Tile heuristic - returns the amount of tiles not
-//           in the correct place
-// Version 3: Manhattan Distance heuristic - returns the sum of the 
-//            distance each displaced node is from their intended position
-// =======================================================================
-int heuristic(Node curr, short ver) {
-    // Array of the location all numbers' goal coordinates
-    pair<int, int> arr[8] = { pair<int, int>(0, 0),
-                              pair<int, int>(1, 0),
-                              pair<int, int>(2, 0),
-                              pair<int, int>(0, 1),
-                              pair<int, int>(1, 1),
-                              pair<int, int>(2, 1),
-                              pair<int, int>(0, 2),
-                              pair<int, int>(1, 2) };
-    int hn = 0; // h(n) counter
-    
-    // Uniform Cost Search
-    if(ver == 1) return hn;
-    
-    // Misplaced Tile Heuristic
-    else if(ver == 2) {
-        // If number is not in correct coordinates, increment h(n)
-        for(int i = 0; i < 8; i++) {
-            if(findNumPos(curr, i+1) != arr[i]) hn++;
-        }
-        return hn;
+// ===========================================================================
+// Solve every board in a batch file with the chosen search, one result per
+// board (in file order) through a ResultWriter. Boards that can't be solved
+// at all are written as failures without searching. threads >= 0 hands the
+// boards to a SolverPool instead of solving them one by one here
+// ===========================================================================
+int solveBatch(const char *fileName, const ModeOptions &options, const short algorithm,
+               const SearchBudget &budget, const char *movesFile, bool binary, int threads, ResultCache *cache) {
+    if(!movesFile) {
+        cout << "--batch needs --moves-file for the results" << endl;
+        return 1;
     }
-    
-    // Manhattan Distance Heuristic
-    else if(ver == 3) {
-        // If number is not in correct coordinates, distance is abs(current x - goal x) +
-        // abs(current y - goal y) aka. x distance + y distance
-        for(int i = 0; i < 8; i++) {
-            pair<int, int> temp = findNumPos(curr, i+1);
-            hn += abs(temp.first - arr[i].first) + abs(temp.second - arr[i].second);
-        }
-        return hn;
+    long long parseStart = nowMicros();
+    BatchInput input;
+    if(!parseBatch(fileName, SIDE, input)) {
+        cout << "Could not read batch file " << fileName << endl;
+        return 1;
     }
+    double parseSeconds = (nowMicros() - parseStart) / 1e6;
+    cout << "Read " << input.boards.size() << " boards (" << input.bytes << " bytes) in " << parseSeconds
+         << " seconds";
+    if(parseSeconds > 0) cout << ", " << input.bytes / parseSeconds / (1 << 20) << " MB/s";
+    cout << endl;
+    for(size_t i = 0; i < input.errors.size() && i < 10; i++) cout << "Skipped " << input.errors[i] << endl;
+    if(input.errors.size() > 10) cout << "... and " << input.errors.size() - 10 << " more bad lines" << endl;
     
-    // In case user inputted a number not between 1-3 
-    cout << "Not a valid algorithm" << endl;
-    return hn;
+    ResultWriter writer(movesFile, binary);
+    if(!writer.isOpen()) {
+        cout << "Could not open moves file " << movesFile << endl;
+        return 1;
+    }
+    // No observer, nothing per board on the console, there could be millions
+    long long solveStart = nowMicros();
+    unsigned long long solved = 0, expansions = 0;
+    SolveOptions solveOptions;
+    solveOptions.algorithm = algorithm;
+    solveOptions.search = options;
+    solveOptions.budget = budget;
+    solveOptions.movePruning = movePruning;
+    solveOptions.cache = cache;
+    // Plain A* goes through one Solver for the whole file, so after the
+    // first few boards it's reusing memory instead of allocating it
+    bool reuse = strcmp(options.mode, "astar") == 0 && threads < 0;
+    Solver solver(movePruning);
+    if(reuse) solveOptions.solver = &solver;
+    unsigned long long warmAllocations = 0;
+    if(threads >= 0) solvePooled(input, solveOptions, threads, writer, solved, expansions);
+    vector<int> board(CELLS);
+    for(size_t i = 0; i < input.boards.size() && threads < 0; i++) {
+        for(int c = 0; c < CELLS; c++) board[c] = (input.boards[i] >> (4*c)) & 0xF;
+        SolveResult result = solve(board, solveOptions);
+        if(i == 0) warmAllocations = solver.allocations();
+        if(result.stats.status == SOLVED) solved++;
+        expansions += result.stats.expansions;
+        writer.write(result.stats, result.moves);
+    }
+    writer.flush();
+    cout << "Solved " << solved << " of " << input.boards.size() << " boards in "
+         << (nowMicros() - solveStart) / 1e6 << " seconds, " << expansions << " nodes expanded" << endl;
+    if(reuse) {
+        cout << "Solver allocations: " << solver.allocations() << " (" << solver.allocations() - warmAllocations
+             << " after the first board), " << solver.memoryBytes() / 1024 << " KB held" << endl;
+    }
+    if(cache) {
+        cout << "Cache: " << cache->hits() << " hits, " << cache->misses() << " misses, " << cache->size()
+             << " boards held" << endl;
+    }
+    return 0;
 }
 
-// =============================================================================
-// This function checks to see if a certain state is equivalent to another state
-// This can be used to check the goal state or repeated states
-// =============================================================================
-bool testState(const Node &node1, const Node &node2) {
-    // Iterate through every position in both node states
-    // If there is a single discrepancy, they are not equal
-    for(int i = 0; i < 3; i++) {
-        for(int j = 0; j < 3; j++) {
-            if(node1.state[i][j] != node2.state[i][j]) {
-                return false;
-            }
+// ===========================================================================
+// solveBatch() on a SolverPool. Results still go out in file order, and
+// only a few boards per thread are queued at a time so a huge file doesn't
+// turn into a huge queue
+// ===========================================================================
+void solvePooled(const BatchInput &input, const SolveOptions &options, int threads, ResultWriter &writer,
+                 unsigned long long &solved, unsigned long long &expansions) {
+    SolverPool pool(threads);
+    size_t window = pool.threadCount() * 16;
+    deque<future<SolveResult> > pending;
+    vector<int> board(CELLS);
+    for(size_t next = 0, done = 0; done < input.boards.size(); ) {
+        if(next < input.boards.size() && pending.size() < window) {
+            for(int c = 0; c < CELLS; c++) board[c] = (input.boards[next] >> (4*c)) & 0xF;
+            pending.push_back(pool.submit(board, options));
+            next++;
+            continue;
         }
+        SolveResult result = pending.front().get();
+        pending.pop_front();
+        done++;
+        if(result.stats.status == SOLVED) solved++;
+        expansions += result.stats.expansions;
+        writer.write(result.stats, result.moves);
     }
-    return true;
 }
 
 // ===========================================================================
-// This function expands a given state, making sure to not add repeated states
+// Boards bigger than 3x3 don't fit in a Node, so they're read straight into
+// a packed state and solved with breadth-first heuristic search
 // ===========================================================================
-void expand(priority_queue<Node, vector<Node>, cmpClass> &q, vector<Node> &history, const short algorithm) {
-    // Array that holds the x/y transforms to find adjacent tile positions
-    // to help with looping
-    // WEIRD TECHNICALITY: Up/Down are reversed due to the nature of how I
-    // made the 2D arrays, whoops
-    pair<int, int> adjacentArr[4] = { pair<int, int>(0, -1),    // Left
-                                      pair<int, int>(1, 0),     // Below
-                                      pair<int, int>(0, 1),     // Right
-                                      pair<int, int>(-1, 0) };  // Up
-    
-    // Get the position of the "blank" in the base node
-    pair<int, int> zeroPos = findNumPos(q.top(), 0);
-    Node temp = q.top();
-    history.push_back(q.top());
-    q.pop();
+int solveLarge(int side, const short algorithm, const SearchBudget &budget) {
+    cout << "Please enter the starting state of the puzzle from the top left number to the bottom ";
+    cout << "right number, ie. \"1 2 3 ... " << side*side-1 << " 0\"" << endl;
+    vector<int> board(side*side, -1);
+    for(int i = 0; i < side*side; i++) cin >> board[i];
+    cout << endl;
     
-    // For loop for each tile around the blank 
-    for(int i = 0; i < 4; i++) {
-        // Flag to see if expanded node was already opened
-        bool alreadyThere = false;
-        
-        // Get position of adjacent tile
-        pair<int, int> adjPos = zeroPos;
-        adjPos.first += adjacentArr[i].first;
-        adjPos.second += adjacentArr[i].second;
-        
-        // If adjacent tile position is within boundaries, aka. it can be shifted
-        // to the blank spot, then continue
-        if((adjPos.first >= 0 && adjPos.first < 3) && (adjPos.second >= 0 && adjPos.second < 3)) {
-            // Create a new node in which a tile has been shifted into the blank spot
-            Node newNode = temp;
-            newNode.gn = temp.gn+1;                 // Iterate cost (depth)
-            nodeNumSwap(newNode, zeroPos, adjPos);  // Perform tile shift
-            newNode.hn = heuristic(newNode, algorithm);        // Calculate heuristic
-            
-            // Search through previous nodes to see if the new state was
-            // visited before, if so, set flag to true
-            for(int j = 0; j < history.size(); j++) {
-                if(testState(history[j], newNode)) alreadyThere = true;
-            }
-            // If flag wasn't triggered, then this is a new state: add to queue
-            if(!alreadyThere) q.push(newNode);
-            alreadyThere = false;   // Reset flag
-        }
+    // solve() checks the tiles and the parity before bfhs ever sees them
+    SolveOptions solveOptions;
+    solveOptions.algorithm = algorithm;
+    solveOptions.search.mode = "bfhs";
+    solveOptions.budget = budget;
+    int begin = time(0);
+    SolveResult solved = solve(board, solveOptions);
+    SearchResult result = solved.stats;
+    int stop = time(0);
+    if(!solved.error.empty()) {
+        cout << "Not a valid puzzle: " << solved.error << endl;
+        return 1;
     }
-}
-
-// ================
-// HELPER FUNCTIONS
-// ================
-
-// =====================================================================
-// Find and return the position of the inputted number in the given node
-// =====================================================================
-pair<int, int> findNumPos(const Node &node, int num) {
-    // i = xPos, j = yPos, searches column by column for number
-    for(int i = 0; i < 3; i++) {
-        for(int j = 0; j < 3; j++) {
-            if(node.state[i][j] == num) return pair<int, int>(i, j);
-        }
+    if(result.status == SOLVED) {
+        cout << "Puzzle solved!" << endl;
+        cout << "Solution depth: " << result.depth << endl;
     }
-    // This should only occur if the inputted number was not between 0-9,
-    // which means something has gone horrifically wrong
-    return pair<int, int>(-1, -1);
+    else if(result.status != NO_SOLUTION) {
+        cout << "Search stopped: " << statusName(result.status) << endl;
+        cout << "Solution depth is at least " << result.lowerBound << endl;
+    }
+    else cout << "Failed to find solution" << endl;
+    cout << "Nodes expanded: " << result.expansions << endl;
+    cout << "Maximum Node Queue Size: " << result.maxQueueSize << endl;
+    cout << "Time taken: " << stop - begin << " seconds" << endl;
+    return 0;
 }
 
-// ============================================================================
-// Shift a tile in the puzzle, in theory a number should only be swapped with 0
-// ============================================================================
-void nodeNumSwap(Node &node, pair<int, int> pos1, pair<int, int> pos2) {
-    // Very basic swap algorithm, I hope I don't have to explain this
-    char temp = node.state[pos1.first][pos1.second];
-    node.state[pos1.first][pos1.second] = node.state[pos2.first][pos2.second];
-    node.state[pos2.first][pos2.second] = temp;
-    return;
+// ==========================================================================
+// Replay a log written with --record: one line per expansion, in the order
+// they happened, as "id parent g(n) h(n) tiles" with tiles in reading order
+// ==========================================================================
+int readLog(const char *fileName) {
+    ExpansionLogReader reader(fileName);
+    if(!reader.isOpen()) {
+        cout << "Could not read expansion log " << fileName << endl;
+        return 1;
+    }
+    int cells = reader.boardSide() * reader.boardSide();
+    ExpansionRecord rec;
+    long long id = 0;
+    unsigned long long maxG = 0;
+    while(reader.next(rec)) {
+        cout << id++ << " " << rec.parent << " " << rec.gn << " " << rec.hn << " ";
+        for(int i = 0; i < cells; i++) cout << ((rec.state >> (4*i)) & 0xF);
+        cout << '\n';
+        if(rec.gn > maxG) maxG = rec.gn;
+    }
+    cout << "Expansions: " << id << ", deepest g(n): " << maxG << endl;
+    return 0;
 }
 
 // ===============================
@@ -297,7 +510,7 @@ void displayNode(const Node node) {
         for(int x = 0; x < 3; x++) {
             cout << node.state[x][y] << " ";
         }
-        cout << endl;
+        cout << '\n';
     }
     return;
-}
\ No newline at end of file
+}
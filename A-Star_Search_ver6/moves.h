@@ -0,0 +1,69 @@
+/* 
+ * File:   moves.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Move tables for an N x N board, generated at compile time
+// For every cell the blank can be in: which cells it can swap with (in the
+// same order the searches have always tried them), and for every tile how much
+// sliding it into the blank changes the Manhattan distance and the
+// misplaced tile count. Successor generation then needs no bounds checks and
+// no board scan, and h(n) of a child is h(n) of its parent plus a lookup.
+// Cells are numbered in reading order, cell = y*N + x.
+
+#ifndef MOVES_H
+#define MOVES_H
+
+// Blank moves as (x, y) offsets: up, right, down, left
+const int BLANK_DX[4] = { 0, 1, 0, -1 };
+const int BLANK_DY[4] = { -1, 0, 1, 0 };
+
+template <int N>
+struct MoveTable {
+    unsigned char count[N*N];               // Legal moves with the blank in this cell
+    unsigned char target[N*N][4];           // Cell the blank swaps with on each of them
+    unsigned char dir[N*N][4];              // Which BLANK_DX/BLANK_DY offset that was
+    signed char manhattan[N*N][N*N][4];     // [tile][blank cell][move] change in Manhattan distance
+    signed char misplaced[N*N][N*N][4];     // [tile][blank cell][move] change in misplaced tiles
+    
+    constexpr MoveTable() : count(), target(), dir(), manhattan(), misplaced() {
+        // Offsets again, the globals above aren't usable in a constant expression
+        const int dx[4] = { 0, 1, 0, -1 };
+        const int dy[4] = { -1, 0, 1, 0 };
+        for(int blank = 0; blank < N*N; blank++) {
+            int bx = blank % N, by = blank / N;
+            for(int d = 0; d < 4; d++) {
+                int tx = bx + dx[d], ty = by + dy[d];
+                if(tx < 0 || tx >= N || ty < 0 || ty >= N) continue;
+                int k = count[blank]++;
+                target[blank][k] = ty*N + tx;
+                dir[blank][k] = d;
+                // Tile at (tx, ty) slides to (bx, by), tile t belongs in cell t-1
+                for(int tile = 1; tile < N*N; tile++) {
+                    int gx = (tile-1) % N, gy = (tile-1) / N;
+                    manhattan[tile][blank][k] = (absDiff(bx, gx) + absDiff(by, gy))
+                                              - (absDiff(tx, gx) + absDiff(ty, gy));
+                    misplaced[tile][blank][k] = (blank != tile-1) - (ty*N + tx != tile-1);
+                }
+            }
+        }
+    }
+    
+    private:
+    static constexpr int absDiff(int a, int b) { return a > b ? a - b : b - a; }
+};
+
+// One shared table per board size, built by the compiler
+template <int N>
+const MoveTable<N> &moveTable() {
+    static constexpr MoveTable<N> table;
+    return table;
+}
+
+// Spot checks that the tables really are compile time constants
+static_assert(MoveTable<3>().count[4] == 4 && MoveTable<3>().count[0] == 2, "3x3 move counts");
+static_assert(MoveTable<4>().manhattan[1][0][1] == -1, "sliding tile 1 home shrinks Manhattan distance");
+
+#endif /* MOVES_H */
@@ -35,15 +35,38 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 
 # Object Files
 OBJECTFILES= \
-	${OBJECTDIR}/main.o
+	${OBJECTDIR}/analysis.o \
+	${OBJECTDIR}/ara.o \
+	${OBJECTDIR}/batch.o \
+	${OBJECTDIR}/beam.o \
+	${OBJECTDIR}/bfhs.o \
+	${OBJECTDIR}/bitboard.o \
+	${OBJECTDIR}/eightpuzzle.o \
+	${OBJECTDIR}/frontier.o \
+	${OBJECTDIR}/ida.o \
+	${OBJECTDIR}/lrta.o \
+	${OBJECTDIR}/main.o \
+	${OBJECTDIR}/output.o \
+	${OBJECTDIR}/progress.o \
+	${OBJECTDIR}/prune.o \
+	${OBJECTDIR}/puzzle.o \
+	${OBJECTDIR}/recorder.o \
+	${OBJECTDIR}/resultcache.o \
+	${OBJECTDIR}/simd.o \
+	${OBJECTDIR}/sma.o \
+	${OBJECTDIR}/solvepool.o \
+	${OBJECTDIR}/solver.o \
+	${OBJECTDIR}/symmetry.o \
+	${OBJECTDIR}/trace.o \
+	${OBJECTDIR}/util.o
 
 
 # C Compiler Flags
 CFLAGS=
 
 # CC Compiler Flags
-CCFLAGS=
-CXXFLAGS=
+CCFLAGS=-pthread
+CXXFLAGS=-pthread
 
 # Fortran Compiler Flags
 FFLAGS=
@@ -62,11 +85,126 @@ ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/a-star_search_ver6.exe: ${OBJECTFILES
 	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
 	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/a-star_search_ver6 ${OBJECTFILES} ${LDLIBSOPTIONS}
 
+${OBJECTDIR}/analysis.o: analysis.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/analysis.o analysis.cpp
+
+${OBJECTDIR}/ara.o: ara.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ara.o ara.cpp
+
+${OBJECTDIR}/batch.o: batch.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/batch.o batch.cpp
+
+${OBJECTDIR}/beam.o: beam.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/beam.o beam.cpp
+
+${OBJECTDIR}/bfhs.o: bfhs.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/bfhs.o bfhs.cpp
+
+${OBJECTDIR}/bitboard.o: bitboard.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/bitboard.o bitboard.cpp
+
+${OBJECTDIR}/eightpuzzle.o: eightpuzzle.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/eightpuzzle.o eightpuzzle.cpp
+
+${OBJECTDIR}/frontier.o: frontier.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/frontier.o frontier.cpp
+
+${OBJECTDIR}/ida.o: ida.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ida.o ida.cpp
+
+${OBJECTDIR}/lrta.o: lrta.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/lrta.o lrta.cpp
+
 ${OBJECTDIR}/main.o: main.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/main.o main.cpp
 
+${OBJECTDIR}/output.o: output.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/output.o output.cpp
+
+${OBJECTDIR}/progress.o: progress.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/progress.o progress.cpp
+
+${OBJECTDIR}/prune.o: prune.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/prune.o prune.cpp
+
+${OBJECTDIR}/puzzle.o: puzzle.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/puzzle.o puzzle.cpp
+
+${OBJECTDIR}/recorder.o: recorder.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/recorder.o recorder.cpp
+
+${OBJECTDIR}/resultcache.o: resultcache.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/resultcache.o resultcache.cpp
+
+${OBJECTDIR}/simd.o: simd.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/simd.o simd.cpp
+
+${OBJECTDIR}/sma.o: sma.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/sma.o sma.cpp
+
+${OBJECTDIR}/solvepool.o: solvepool.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/solvepool.o solvepool.cpp
+
+${OBJECTDIR}/solver.o: solver.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/solver.o solver.cpp
+
+${OBJECTDIR}/symmetry.o: symmetry.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/symmetry.o symmetry.cpp
+
+${OBJECTDIR}/trace.o: trace.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/trace.o trace.cpp
+
+${OBJECTDIR}/util.o: util.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/util.o util.cpp
+
 # Subprojects
 .build-subprojects:
 
@@ -0,0 +1,102 @@
+/* 
+ * File:   output.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <cstdio>
+#include "moves.h"
+#include "output.h"
+using namespace std;
+
+const char MOVE_NAMES[4] = { 'U', 'R', 'D', 'L' };
+const size_t FLUSH_SIZE = 1 << 16;      // Bytes buffered before they're written
+
+// Cell the blank is in on a packed board
+static int blankCell(unsigned long long packed, int side) {
+    for(int cell = 0; cell < side*side; cell++) {
+        if(((packed >> (4*cell)) & 0xF) == 0) return cell;
+    }
+    return -1;
+}
+
+string moveString(const vector<unsigned long long> &path, int side) {
+    string moves;
+    for(size_t i = 1; i < path.size(); i++) {
+        int from = blankCell(path[i-1], side), to = blankCell(path[i], side);
+        int dx = to % side - from % side, dy = to / side - from / side;
+        int dir = 0;
+        while(dir < 4 && (BLANK_DX[dir] != dx || BLANK_DY[dir] != dy)) dir++;
+        // Only the blank and the tile it swapped with may differ
+        unsigned long long swapped = path[i-1] ^ (((path[i] >> (4*from)) & 0xF) << (4*from))
+                                               ^ (((path[i] >> (4*from)) & 0xF) << (4*to));
+        if(from < 0 || to < 0 || dir == 4 || swapped != path[i]) return "";
+        moves += MOVE_NAMES[dir];
+    }
+    return moves;
+}
+
+string moveString(const vector<Node> &path) {
+    vector<unsigned long long> packed;
+    for(size_t i = 0; i < path.size(); i++) packed.push_back(packState(path[i]));
+    return moveString(packed, SIDE);
+}
+
+ResultWriter::ResultWriter(const string &fileName, bool binary)
+    : out(fileName.c_str(), binary ? ios::binary : ios::out), binary(binary) {
+    buffer.reserve(FLUSH_SIZE + 256);
+}
+
+ResultWriter::~ResultWriter() {
+    flush();
+}
+
+void ResultWriter::putVarint(unsigned long long value) {
+    while(value >= 0x80) {
+        buffer += (char)(value | 0x80);
+        value >>= 7;
+    }
+    buffer += (char)value;
+}
+
+// ================================================================
+// Encode one result into the buffer, only touching the file once the
+// buffer's big enough to be worth it
+// ================================================================
+void ResultWriter::write(const SearchResult &result, const string &moves) {
+    bool solved = result.status == SOLVED;
+    bool known = solved && moves.size() == result.depth;
+    if(binary) {
+        putVarint(known ? moves.size() + 1 : 0);
+        if(known) {
+            unsigned char byte = 0;
+            for(size_t i = 0; i < moves.size(); i++) {
+                int dir = 0;
+                while(dir < 3 && MOVE_NAMES[dir] != moves[i]) dir++;
+                byte |= dir << (2 * (i % 4));
+                if(i % 4 == 3) {
+                    buffer += (char)byte;
+                    byte = 0;
+                }
+            }
+            if(moves.size() % 4) buffer += (char)byte;
+        }
+    }
+    else {
+        char depth[24];
+        snprintf(depth, sizeof(depth), "%lld ", solved ? (long long)result.depth : -1LL);
+        buffer += depth;
+        if(!solved) buffer += statusName(result.status);
+        else buffer += known ? moves : "?";
+        buffer += '\n';
+    }
+    if(buffer.size() >= FLUSH_SIZE) flush();
+}
+
+void ResultWriter::flush() {
+    if(buffer.empty()) return;
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    buffer.clear();
+}
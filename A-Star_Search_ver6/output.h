@@ -0,0 +1,54 @@
+/* 
+ * File:   output.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Solutions as move lists instead of boards
+// A move is named after the way the blank goes: U, R, D or L (the same order
+// as BLANK_DX/BLANK_DY). Results are built up in a buffer and written out a
+// big chunk at a time, so writing millions of them costs a few large writes.
+//
+// Text format, one line per result:
+//   depth, a space, the moves            ie. "3 RDD"
+//   depth, a space, "?"                  solved, but the moves aren't known
+//   "-1 " and the status name            when it wasn't solved
+// Binary format, per result (varints are little-endian base-128):
+//   varint depth + 1, 0 when it wasn't solved (or the moves aren't known)
+//   the moves, 2 bits each (U=0 R=1 D=2 L=3), first move in the lowest bits,
+//   padded out to a whole byte
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "puzzle.h"
+
+// Moves taking each packed board in path to the next, "" if the path has a
+// gap in it (two boards in a row that aren't one slide apart)
+std::string moveString(const std::vector<unsigned long long> &path, int side = SIDE);
+std::string moveString(const std::vector<Node> &path);
+
+class ResultWriter {
+    public:
+    ResultWriter(const std::string &fileName, bool binary);
+    ~ResultWriter();    // Writes whatever is still buffered
+    
+    bool isOpen() const { return out.is_open(); }
+    // moves is a moveString(), only used when result is SOLVED and it has
+    // result.depth moves (search modes that don't keep the path can pass "")
+    void write(const SearchResult &result, const std::string &moves);
+    void flush();
+    
+    private:
+    void putVarint(unsigned long long value);
+    
+    std::ofstream out;
+    bool binary;
+    std::string buffer;
+};
+
+#endif /* OUTPUT_H */
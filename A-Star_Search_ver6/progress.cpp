@@ -0,0 +1,81 @@
+/* 
+ * File:   progress.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <chrono>
+#include <cstdio>
+#include "progress.h"
+#include "util.h"
+using namespace std;
+
+// ===============================================================
+// Start sampling, a file that can't be opened falls back to stderr
+// ===============================================================
+ProgressReporter::ProgressReporter(const SearchCounters &counters, int intervalMs, const string &statsFile)
+    : counters(counters), intervalMs(intervalMs > 0 ? intervalMs : 1000), toFile(false), stopping(false) {
+    if(!statsFile.empty()) {
+        stats.open(statsFile.c_str());
+        toFile = stats.is_open();
+        if(toFile) stats << "elapsed_ms,expansions,nodes_per_sec,f_bound,open,closed,rss_bytes\n";
+        else fprintf(stderr, "Could not open stats file %s, reporting to stderr\n", statsFile.c_str());
+    }
+    reporter = thread(&ProgressReporter::reporterLoop, this);
+}
+
+ProgressReporter::~ProgressReporter() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    reporter.join();
+}
+
+// ===================================================================
+// Wake up every interval, turn the expansion count into a rate and
+// report. Exits right away when stopped instead of finishing a sleep
+// ===================================================================
+void ProgressReporter::reporterLoop() {
+    long long start = nowMicros();
+    long long lastTime = start;
+    unsigned long long lastCount = 0;
+    bool finished = false;
+    while(!finished) {
+        {
+            unique_lock<mutex> guard(lock);
+            finished = wake.wait_for(guard, chrono::milliseconds(intervalMs), [this] { return stopping; });
+        }
+        long long now = nowMicros();
+        unsigned long long count = counters.expansions.load(memory_order_relaxed);
+        unsigned long long perSec = now > lastTime ? (count - lastCount) * 1000000ULL / (now - lastTime) : 0;
+        report(now - start, perSec);
+        lastTime = now;
+        lastCount = count;
+    }
+    if(!toFile) fprintf(stderr, "\n");
+}
+
+// ==================================
+// Print (or log) a single sample
+// ==================================
+void ProgressReporter::report(long long elapsedUs, unsigned long long perSec) {
+    unsigned long long expansions = counters.expansions.load(memory_order_relaxed);
+    unsigned long long fBound = counters.fBound.load(memory_order_relaxed);
+    unsigned long long open = counters.openSize.load(memory_order_relaxed);
+    unsigned long long closed = counters.closedSize.load(memory_order_relaxed);
+    long long rss = currentRSS();
+    if(toFile) {
+        stats << elapsedUs / 1000 << "," << expansions << "," << perSec << "," << fBound << ","
+              << open << "," << closed << "," << rss << "\n";
+        stats.flush();
+    }
+    else {
+        // \r so the line updates in place on a terminal
+        fprintf(stderr, "\r[%.1fs] expanded %llu (%llu/s)  f-bound %llu  open %llu  closed %llu  rss %lld MB   ",
+                elapsedUs / 1e6, expansions, perSec, fBound, open, closed, rss >> 20);
+        fflush(stderr);
+    }
+}
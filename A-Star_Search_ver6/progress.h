@@ -0,0 +1,45 @@
+/* 
+ * File:   progress.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Live progress heartbeat for long solves
+// The search only does relaxed atomic stores into SearchCounters (puzzle.h,
+// handed over in SearchBudget::counters), a reporter
+// thread samples them every so often and prints a status line (or appends a
+// CSV row to a stats file). Nothing in the search path ever takes a lock.
+
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "puzzle.h"
+
+class ProgressReporter {
+    public:
+    // An empty statsFile means print a status line to stderr instead
+    ProgressReporter(const SearchCounters &counters, int intervalMs, const std::string &statsFile);
+    ~ProgressReporter();    // Prints one last sample and stops the thread
+    
+    private:
+    void reporterLoop();
+    void report(long long elapsedUs, unsigned long long perSec);
+    
+    const SearchCounters &counters;
+    int intervalMs;
+    std::ofstream stats;
+    bool toFile;
+    bool stopping;
+    std::mutex lock;                    // Only guards stopping, never touched by the search
+    std::condition_variable wake;
+    std::thread reporter;
+};
+
+#endif /* PROGRESS_H */
@@ -0,0 +1,183 @@
+/* 
+ * File:   prune.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "moves.h"
+#include "prune.h"
+#include "puzzle.h"
+using namespace std;
+
+// Smallest box around a set of cells
+struct Box {
+    int minX, maxX, minY, maxY;
+};
+
+// A move string tried on an unbounded board, blank starting at (0, 0)
+// Tiles are named after the cell they started in, and only the tiles that
+// moved are kept (cell, name), sorted, so equal results have equal lists
+struct MoveString {
+    string moves;               // Blank moves, one char '0'-'3' each
+    int bx, by;                 // Where the blank is now
+    Box box;                    // Every cell the blank went through
+    vector<pair<int, int> > moved;
+};
+
+// Cells are numbered on a board big enough that no string walks off it
+static int cellKey(int x, int y) {
+    return (x + 64) * 256 + (y + 64);
+}
+
+// ==================================================
+// Same result (tiles and blank) reached by both strings
+// ==================================================
+static string resultKey(const MoveString &s) {
+    string key;
+    key += (char)(s.bx + 64);
+    key += (char)(s.by + 64);
+    for(size_t i = 0; i < s.moved.size(); i++) {
+        key.append((const char *)&s.moved[i], sizeof(s.moved[i]));
+    }
+    return key;
+}
+
+// ===================================================================
+// Slide the tile next to the blank (direction dir) into the blank's cell
+// ===================================================================
+static MoveString extend(const MoveString &s, int dir) {
+    MoveString next = s;
+    next.moves += (char)('0' + dir);
+    int from = cellKey(s.bx + BLANK_DX[dir], s.by + BLANK_DY[dir]);
+    int to = cellKey(s.bx, s.by);
+    
+    // Name of the tile that slides, then it's gone from its old cell
+    int name = from;
+    vector<pair<int, int> >::iterator it = lower_bound(next.moved.begin(), next.moved.end(), pair<int, int>(from, -1));
+    if(it != next.moved.end() && it->first == from) {
+        name = it->second;
+        next.moved.erase(it);
+    }
+    // Which still leaves the blank's old cell, unless the tile just went home
+    // (the blank's own starting cell is never home to a tile)
+    if(name != to) {
+        it = lower_bound(next.moved.begin(), next.moved.end(), pair<int, int>(to, -1));
+        next.moved.insert(it, pair<int, int>(to, name));
+    }
+    
+    next.bx += BLANK_DX[dir];
+    next.by += BLANK_DY[dir];
+    next.box.minX = min(next.box.minX, next.bx);
+    next.box.maxX = max(next.box.maxX, next.bx);
+    next.box.minY = min(next.box.minY, next.by);
+    next.box.maxY = max(next.box.maxY, next.by);
+    return next;
+}
+
+MovePruner::MovePruner(int side, int maxLength) : rules(0) {
+    // Breadth first over move strings, each level in alphabetical order, so
+    // the first string to reach a result is the shortest, earliest one
+    unordered_set<string> forbidden;
+    unordered_map<string, Box> firstFound;
+    vector<MoveString> level(1);
+    level[0].moves = "";
+    level[0].bx = level[0].by = 0;
+    level[0].box.minX = level[0].box.maxX = level[0].box.minY = level[0].box.maxY = 0;
+    firstFound[resultKey(level[0])] = level[0].box;
+    
+    for(int length = 1; length <= maxLength; length++) {
+        vector<MoveString> nextLevel;
+        for(size_t i = 0; i < level.size(); i++) {
+            for(int dir = 0; dir < 4; dir++) {
+                MoveString s = extend(level[i], dir);
+                // Strings whose blank needs more room than the board has can
+                // never be played, so there's nothing to forbid past them
+                if(s.box.maxX - s.box.minX >= side || s.box.maxY - s.box.minY >= side) continue;
+                // Anything ending in a forbidden string is never generated
+                bool pruned = false;
+                for(size_t start = 0; start + 1 < s.moves.size() && !pruned; start++) {
+                    if(forbidden.count(s.moves.substr(start))) pruned = true;
+                }
+                if(pruned) continue;
+                
+                // Same result as an earlier string: forbidden, as long as the
+                // earlier one never needs a cell this one doesn't
+                string key = resultKey(s);
+                unordered_map<string, Box>::iterator seen = firstFound.find(key);
+                if(seen != firstFound.end()) {
+                    const Box &t = seen->second;
+                    if(t.minX >= s.box.minX && t.maxX <= s.box.maxX && t.minY >= s.box.minY && t.maxY <= s.box.maxY) {
+                        forbidden.insert(s.moves);
+                        continue;
+                    }
+                }
+                else firstFound[key] = s.box;
+                nextLevel.push_back(s);
+            }
+        }
+        level.swap(nextLevel);
+    }
+    rules = forbidden.size();
+    
+    // Aho-Corasick over the forbidden strings: a trie, then failure links so
+    // every state knows the longest forbidden-string prefix its moves end in
+    vector<int> trie(4, -1);
+    vector<bool> dead(1, false);
+    for(unordered_set<string>::iterator it = forbidden.begin(); it != forbidden.end(); ++it) {
+        int state = 0;
+        for(size_t i = 0; i < it->size(); i++) {
+            int dir = (*it)[i] - '0';
+            if(trie[state*4 + dir] < 0) {
+                trie[state*4 + dir] = dead.size();
+                dead.push_back(false);
+                trie.resize(trie.size() + 4, -1);
+            }
+            state = trie[state*4 + dir];
+        }
+        dead[state] = true;
+    }
+    vector<int> fail(dead.size(), 0);
+    table.assign(trie.size(), 0);
+    queue<int> frontier;
+    for(int dir = 0; dir < 4; dir++) {
+        if(trie[dir] < 0) table[dir] = 0;
+        else {
+            table[dir] = trie[dir];
+            frontier.push(trie[dir]);
+        }
+    }
+    while(!frontier.empty()) {
+        int state = frontier.front();
+        frontier.pop();
+        if(dead[fail[state]]) dead[state] = true;
+        for(int dir = 0; dir < 4; dir++) {
+            int child = trie[state*4 + dir];
+            if(child < 0) table[state*4 + dir] = table[fail[state]*4 + dir];
+            else {
+                fail[child] = table[fail[state]*4 + dir];
+                table[state*4 + dir] = child;
+                frontier.push(child);
+            }
+        }
+    }
+    // Moves into a forbidden string are the pruned ones
+    for(size_t i = 0; i < table.size(); i++) {
+        if(dead[table[i]]) table[i] = -1;
+    }
+}
+
+const MovePruner &movePruner() {
+    static MovePruner pruner(SIDE, PRUNE_DEPTH);
+    return pruner;
+}
+
+const MovePruner &undoPruner() {
+    static MovePruner pruner(SIDE, 2);
+    return pruner;
+}
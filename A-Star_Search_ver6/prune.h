@@ -0,0 +1,56 @@
+/* 
+ * File:   prune.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Move pruning automaton (Taylor & Korf style duplicate avoidance)
+// Operators are the four blank moves (BLANK_DX/BLANK_DY order). Every string
+// of blank moves up to some length is tried on an unbounded board, and a
+// string is forbidden when a shorter or same length but alphabetically
+// earlier string gets the same result while staying inside the same box of
+// cells (so the earlier string works anywhere the forbidden one does).
+// The forbidden strings become an Aho-Corasick automaton: a search keeps the
+// automaton state in each node, and a move whose transition lands on a
+// forbidden string is never generated. The shortest rules are the undo
+// moves (blank up then down etc.), longer ones cut redundant cycles.
+
+#ifndef PRUNE_H
+#define PRUNE_H
+
+#include <cstddef>
+#include <vector>
+
+class MovePruner {
+    public:
+    // Built from every move string of up to maxLength moves that fits on a
+    // side x side board. 2 only forbids undoing the last move, 0 forbids nothing
+    MovePruner(int side, int maxLength);
+    
+    // Automaton state of a node with no move history
+    int start() const { return 0; }
+    // State after taking blank move dir (0-3) from state, -1 if that move is pruned
+    int next(int state, int dir) const { return table[state*4 + dir]; }
+    
+    size_t stateCount() const { return table.size() / 4; }
+    size_t ruleCount() const { return rules; }
+    
+    private:
+    std::vector<int> table;     // [state*4 + dir], -1 for a pruned move
+    size_t rules;
+};
+
+// The automaton searches share, built the first time it's asked for. Only
+// for tree searches (IDA*): with duplicate detection on top, the copy of a
+// board that's kept can have a move history that forbids moves the copy
+// that was thrown away needed, and the search misses the shortest path
+const MovePruner &movePruner();
+// Just the undo moves, safe for searches that drop duplicates (A*): the
+// parent a kept copy can't go back to is already expanded more cheaply
+const MovePruner &undoPruner();
+
+// Length of the move strings movePruner() checks
+const int PRUNE_DEPTH = 14;
+
+#endif /* PRUNE_H */
@@ -0,0 +1,284 @@
+/* 
+ * File:   puzzle.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// The puzzle itself: heuristics, state comparison and the small helpers
+// that every search mode shares. Moved out of main.cpp so the analysis and
+// search mode files can use them too.
+
+#include <cstdlib>
+#include "moves.h"
+#include "puzzle.h"
+#include "util.h"
+using namespace std;
+
+// The clock, the memory estimate and the cancel flag are only looked at
+// every this many expansions, the expansion count itself is checked every time
+const unsigned long long BUDGET_CHECK_INTERVAL = 256;
+
+// =======================================================================
+// THE ONLY FUNCTION THAT SHOULD CHANGE BETWEEN ALL 3 VERSIONS OF THE CODE
+// This code calculates the h(n) of a particular node
+// Version 1: Uniform Cost Search - always returns 0
+// Version 2: Misplaced Tile heuristic - returns the amount of tiles not
+//           in the correct place
+// Version 3: Manhattan Distance heuristic - returns the sum of the 
+//            distance each displaced node is from their intended position
+// =======================================================================
+int heuristic(Node curr, short ver) {
+    // Tile t belongs in cell t-1 (reading order), and pos[] says which
+    // cell each tile is in right now, so there's no searching the board
+    int hn = 0; // h(n) counter
+    
+    // Uniform Cost Search
+    if(ver == 1) return hn;
+    
+    // Misplaced Tile Heuristic
+    else if(ver == 2) {
+        // If number is not in correct coordinates, increment h(n)
+        for(int i = 0; i < 8; i++) {
+            if(curr.pos[i+1] != i) hn++;
+        }
+        return hn;
+    }
+    
+    // Manhattan Distance Heuristic
+    else if(ver == 3) {
+        // If number is not in correct coordinates, distance is abs(current x - goal x) +
+        // abs(current y - goal y) aka. x distance + y distance
+        for(int i = 0; i < 8; i++) {
+            int cell = curr.pos[i+1];
+            hn += abs(cell % SIDE - i % SIDE) + abs(cell / SIDE - i / SIDE);
+        }
+        return hn;
+    }
+    
+    // In case user inputted a number not between 1-3 (main() complains
+    // about that, nothing in here should print)
+    return hn;
+}
+
+// ==========================================================================
+// Same heuristics, but to any target board instead of the goal (for
+// searches that split a solution in half and solve each half on its own)
+// ==========================================================================
+int heuristicTo(const Node &curr, const Node &target, const short ver) {
+    int hn = 0;
+    if(ver != 2 && ver != 3) return hn;
+    for(int tile = 1; tile < CELLS; tile++) {
+        int cell = curr.pos[tile], home = target.pos[tile];
+        if(ver == 2) hn += cell != home;
+        else hn += abs(cell % SIDE - home % SIDE) + abs(cell / SIDE - home / SIDE);
+    }
+    return hn;
+}
+
+// =============================================================================
+// This function checks to see if a certain state is equivalent to another state
+// This can be used to check the goal state or repeated states
+// =============================================================================
+bool testState(const Node &node1, const Node &node2) {
+    // Iterate through every position in both node states
+    // If there is a single discrepancy, they are not equal
+    for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+            if(node1.state[i][j] != node2.state[i][j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ================
+// HELPER FUNCTIONS
+// ================
+
+// =====================================================================
+// Find and return the position of the inputted number in the given node
+// =====================================================================
+pair<int, int> findNumPos(const Node &node, int num) {
+    // No searching needed, the node keeps track of where every tile is
+    // (first = xPos, second = yPos)
+    // This should only fail if the inputted number was not between 0-8,
+    // which means something has gone horrifically wrong
+    if(num < 0 || num >= CELLS) return pair<int, int>(-1, -1);
+    return pair<int, int>(node.pos[num] % SIDE, node.pos[num] / SIDE);
+}
+
+// ============================================================================
+// Shift a tile in the puzzle, in theory a number should only be swapped with 0
+// ============================================================================
+void nodeNumSwap(Node &node, pair<int, int> pos1, pair<int, int> pos2) {
+    // Very basic swap algorithm, I hope I don't have to explain this
+    char temp = node.state[pos1.first][pos1.second];
+    node.state[pos1.first][pos1.second] = node.state[pos2.first][pos2.second];
+    node.state[pos2.first][pos2.second] = temp;
+    // Keep the tile -> cell map in step
+    node.pos[node.state[pos1.first][pos1.second]] = pos1.second*SIDE + pos1.first;
+    node.pos[node.state[pos2.first][pos2.second]] = pos2.second*SIDE + pos2.first;
+    return;
+}
+
+// ===========================================================================
+// Pack a state into 4 bits per tile, reading order (top left tile is lowest)
+// ===========================================================================
+unsigned long long packState(const Node &node) {
+    unsigned long long packed = 0;
+    for(int y = 0; y < 3; y++) {
+        for(int x = 0; x < 3; x++) {
+            packed |= (unsigned long long)node.state[x][y] << (4*(y*3+x));
+        }
+    }
+    return packed;
+}
+
+// ==================================
+// Inverse of packState(), g/h zeroed
+// ==================================
+Node unpackState(unsigned long long packed) {
+    Node node;
+    for(int y = 0; y < 3; y++) {
+        for(int x = 0; x < 3; x++) {
+            node.state[x][y] = (packed >> (4*(y*3+x))) & 0xF;
+        }
+    }
+    node.gn = 0;
+    node.hn = 0;
+    node.fsm = 0;
+    node.parent = -1;
+    syncPositions(node);
+    return node;
+}
+
+// ==========================================
+// The goal state, 1-8 in order and blank last
+// ==========================================
+Node goalNode() {
+    Node goal;
+    int arr[9] = { 1, 2, 3, 4, 5, 6, 7, 8, 0 };
+    for(int y = 0; y < 3; y++) {
+        for(int x = 0; x < 3; x++) {
+            goal.state[x][y] = arr[(y*3)+x];
+        }
+    }
+    goal.hn = goal.gn = 0;
+    goal.fsm = 0;
+    goal.parent = -1;
+    syncPositions(goal);
+    return goal;
+}
+
+// ==================================================================
+// Work out where every tile is, for nodes filled in from scratch (every
+// move after that keeps pos[] up to date on its own)
+// ==================================================================
+void syncPositions(Node &node) {
+    for(int y = 0; y < 3; y++) {
+        for(int x = 0; x < 3; x++) {
+            // Anything outside 0-8 isn't a tile, it has nowhere to go
+            if(node.state[x][y] >= 0 && node.state[x][y] < CELLS) node.pos[node.state[x][y]] = y*SIDE + x;
+        }
+    }
+}
+
+// ===========================================================================
+// How much h(n) changes when the blank, sitting in cell blank, takes its
+// move'th legal move (moveTable().target order) and tile slides into it.
+// Lets a child's h(n) be worked out from its parent's with one lookup
+// ===========================================================================
+int heuristicDelta(const short ver, int tile, int blank, int move) {
+    if(ver == 2) return moveTable<SIDE>().misplaced[tile][blank][move];
+    if(ver == 3) return moveTable<SIDE>().manhattan[tile][blank][move];
+    return 0;
+}
+
+// ===========================================================================
+// Fill children with every state one slide away from curr, up, right,
+// down, left. g(n) is one more than curr's, h(n) and parent are left for
+// the caller. Returns how many children there are (2 to 4)
+// ===========================================================================
+int generateChildren(const Node &curr, Node children[4]) {
+    const MoveTable<SIDE> &moves = moveTable<SIDE>();
+    int blank = curr.pos[0];
+    int count = moves.count[blank];
+    for(int i = 0; i < count; i++) {
+        int cell = moves.target[blank][i];
+        Node &child = children[i];
+        child = curr;
+        child.gn = curr.gn + 1;
+        int tile = curr.state[cell % SIDE][cell / SIDE];
+        child.state[blank % SIDE][blank / SIDE] = tile;
+        child.state[cell % SIDE][cell / SIDE] = 0;
+        child.pos[tile] = blank;
+        child.pos[0] = cell;
+    }
+    return count;
+}
+
+// ===========================================================================
+// Tell budget.counters (if anyone's watching) where the search is. Relaxed
+// stores, called right next to checkBudget() so every mode reports as it goes
+// ===========================================================================
+void publishCounters(const SearchBudget &budget, unsigned long long expansions, unsigned long long fBound,
+                     unsigned long long openSize, unsigned long long closedSize) {
+    SearchCounters *counters = budget.counters;
+    if(!counters) return;
+    counters->expansions.store(expansions, memory_order_relaxed);
+    counters->fBound.store(fBound, memory_order_relaxed);
+    counters->openSize.store(openSize, memory_order_relaxed);
+    counters->closedSize.store(closedSize, memory_order_relaxed);
+}
+
+// Whether either of the budget's cancel flags has been set
+bool budgetCancelled(const SearchBudget &budget) {
+    return (budget.cancel && budget.cancel->load(memory_order_relaxed))
+           || (budget.poolCancel && budget.poolCancel->load(memory_order_relaxed));
+}
+
+// ===========================================================================
+// Compare a running search against its budget, returns WITHIN_BUDGET if it's
+// still within every limit (ie. "keep going") or which limit it ran into.
+// startUs comes from nowMicros() when the search began
+// ===========================================================================
+SearchStatus checkBudget(const SearchBudget &budget, long long startUs, unsigned long long expansions,
+                         unsigned long long memoryBytes) {
+    if(budget.maxExpansions && expansions >= budget.maxExpansions) return EXPANSIONS_EXCEEDED;
+    if(expansions % BUDGET_CHECK_INTERVAL != 0) return WITHIN_BUDGET;
+    return checkBudgetNow(budget, startUs, expansions, memoryBytes);
+}
+
+// ===========================================================================
+// Same, but every limit every time. For searches that check in rarely and
+// with counts that jump (once a layer, once a move), where the interval in
+// checkBudget() would almost never line up
+// ===========================================================================
+SearchStatus checkBudgetNow(const SearchBudget &budget, long long startUs, unsigned long long expansions,
+                            unsigned long long memoryBytes) {
+    if(budget.maxExpansions && expansions >= budget.maxExpansions) return EXPANSIONS_EXCEEDED;
+    if(budgetCancelled(budget)) return CANCELLED;
+    if(budget.maxMemoryBytes && memoryBytes >= budget.maxMemoryBytes) return MEMORY_EXCEEDED;
+    if(budget.timeLimitMs && (unsigned long long)(nowMicros() - startUs) >= budget.timeLimitMs * 1000) {
+        return TIME_EXCEEDED;
+    }
+    return WITHIN_BUDGET;
+}
+
+// ===========================================
+// Human readable version of a search status
+// ===========================================
+const char *statusName(SearchStatus status) {
+    switch(status) {
+        case SOLVED: return "solved";
+        case NO_SOLUTION: return "no solution";
+        case TIME_EXCEEDED: return "time limit exceeded";
+        case EXPANSIONS_EXCEEDED: return "expansion limit exceeded";
+        case MEMORY_EXCEEDED: return "memory limit exceeded";
+        case CANCELLED: return "cancelled";
+        case WITHIN_BUDGET: return "within budget";
+    }
+    return "unknown";
+}
@@ -0,0 +1,126 @@
+/* 
+ * File:   puzzle.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Puzzle state node and the helper functions shared by every search mode
+
+#ifndef PUZZLE_H
+#define PUZZLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Board size
+const int SIDE = 3;
+const int CELLS = SIDE * SIDE;
+
+// Structures
+// State node
+struct Node {
+    short state[3][3];   // Puzzle grid, 0 represents the blank space
+    // gn = depth = path cost
+    // hn = hueristic distance to goal
+    unsigned long long int gn; 
+    unsigned short hn;
+    unsigned char pos[CELLS];   // Cell (y*3 + x) each tile is in, pos[0] is the blank. Kept in sync by every move
+    int fsm;            // Move pruning automaton state (see prune.h), 0 for no history
+    long long parent;   // Index in history of the node this was expanded from, -1 for the start
+};
+// Custom comparison class to sort by g(n) + h(n) in priority queue
+// Ties go to the deeper node, it's closer to being a solution
+class cmpClass {
+    public:
+    bool operator()(const Node &lhs, const Node &rhs) {
+        if(lhs.gn + lhs.hn != rhs.gn + rhs.hn) return (lhs.gn + lhs.hn) > (rhs.gn + rhs.hn);
+        return lhs.gn < rhs.gn;
+    }
+};
+
+// Where a running search is at, for a progress reporter (progress.h) to
+// sample from another thread. Every mode fills these in its own terms: fBound
+// is whatever bound it's working under, closedSize whatever it keeps behind it
+struct SearchCounters {
+    std::atomic<unsigned long long> expansions;
+    std::atomic<unsigned long long> fBound;
+    std::atomic<unsigned long long> openSize;
+    std::atomic<unsigned long long> closedSize;
+    
+    SearchCounters() : expansions(0), fBound(0), openSize(0), closedSize(0) {}
+};
+
+// Limits for a single search, 0 means unlimited
+struct SearchBudget {
+    unsigned long long timeLimitMs;
+    unsigned long long maxExpansions;
+    unsigned long long maxMemoryBytes;     // Estimated from the nodes the search is holding
+    const std::atomic<bool> *cancel;       // Stop as soon as this turns true, NULL for never
+    const std::atomic<bool> *poolCancel;   // SolverPool's flag for the job, set next to cancel (either stops it)
+    SearchCounters *counters;              // Progress goes here (see publishCounters()), NULL for nowhere
+    
+    SearchBudget() : timeLimitMs(0), maxExpansions(0), maxMemoryBytes(0), cancel(NULL), poolCancel(NULL),
+                     counters(NULL) {}
+};
+// Hooks for watching a search from outside, how the command line hangs its
+// verbose output, trace and expansion log on the library's searches. Only
+// plain A* (Solver) and ARA* call them, and every hook does nothing unless
+// it's overridden
+class SearchObserver {
+    public:
+    virtual ~SearchObserver() {}
+    // A* reached a state it hadn't seen before. id counts them from 0 (the
+    // start) in the order they turn up
+    virtual void discovered(const Node &, long long) {}
+    // A* is about to expand state id, parent is the id it was reached from
+    // (-1 for the start). open and closed are the list sizes right now
+    virtual void expanding(const Node &, long long, long long, unsigned long long, unsigned long long) {}
+    // The f(n) A* is expanding at went up (or got its first value)
+    virtual void newBound(unsigned long long) {}
+    // ARA* found a better solution, start first, proven to be at most bound
+    // times the optimal depth
+    virtual void improved(const std::vector<Node> &, double) {}
+};
+
+// How a search ended. WITHIN_BUDGET is only what checkBudget() says when
+// nothing has run out yet, a finished search never reports it
+enum SearchStatus { SOLVED, NO_SOLUTION, TIME_EXCEEDED, EXPANSIONS_EXCEEDED, MEMORY_EXCEEDED, CANCELLED, WITHIN_BUDGET };
+// Everything a search reports back, whether or not it finished
+struct SearchResult {
+    SearchStatus status;
+    unsigned long long depth;          // Solution depth, only meaningful when solved
+    unsigned long long lowerBound;     // Proven lower bound on the solution depth
+    unsigned long long expansions;
+    unsigned long long maxQueueSize;
+    unsigned long long memoryBytes;    // Estimated node memory when the search stopped
+    double seconds;
+    
+    SearchResult() : status(NO_SOLUTION), depth(0), lowerBound(0), expansions(0),
+                     maxQueueSize(0), memoryBytes(0), seconds(0) {}
+};
+
+// Function prototypes
+int heuristic(Node, const short);
+int heuristicTo(const Node &, const Node &, const short);
+bool testState(const Node &, const Node &);
+
+// HELPER FUNCTIONS
+std::pair<int, int> findNumPos(const Node &, int);
+void nodeNumSwap(Node &, std::pair<int, int>, std::pair<int, int>);
+unsigned long long packState(const Node &);
+Node unpackState(unsigned long long);
+Node goalNode();
+void syncPositions(Node &);
+int heuristicDelta(const short, int, int, int);
+int generateChildren(const Node &, Node[4]);
+bool budgetCancelled(const SearchBudget &);
+void publishCounters(const SearchBudget &, unsigned long long, unsigned long long, unsigned long long,
+                     unsigned long long);
+SearchStatus checkBudget(const SearchBudget &, long long, unsigned long long, unsigned long long);
+SearchStatus checkBudgetNow(const SearchBudget &, long long, unsigned long long, unsigned long long);
+const char *statusName(SearchStatus);
+
+#endif /* PUZZLE_H */
@@ -0,0 +1,201 @@
+/* 
+ * File:   recorder.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <chrono>
+#include "recorder.h"
+using namespace std;
+
+const size_t RING_SIZE = 1 << 16;           // Records in flight between the threads
+const size_t FLUSH_SIZE = 1 << 16;          // Bytes buffered before writing to the file
+const unsigned char FULL_STATE = 0xFF;      // Move byte meaning "full state follows"
+const char LOG_MAGIC[4] = { 'A', 'S', 'X', 'L' };
+const char LOG_VERSION = 1;
+
+// ======================================================================
+// Find where the blank moved to if child is parent with one slide done,
+// returns -1 otherwise
+// ======================================================================
+static int slideTarget(unsigned long long parent, unsigned long long child, int cells) {
+    int parentBlank = -1, childBlank = -1;
+    for(int i = 0; i < cells; i++) {
+        if(((parent >> (4*i)) & 0xF) == 0) parentBlank = i;
+        if(((child >> (4*i)) & 0xF) == 0) childBlank = i;
+    }
+    if(parentBlank < 0 || childBlank < 0 || parentBlank == childBlank) return -1;
+    // Redo the slide on the parent and see if it matches
+    unsigned long long tile = (parent >> (4*childBlank)) & 0xF;
+    unsigned long long slid = (parent & ~(0xFULL << (4*childBlank))) | (tile << (4*parentBlank));
+    return slid == child ? childBlank : -1;
+}
+
+// Redo a slide on a packed state: the tile at cell "to" moves into the blank
+static unsigned long long applySlide(unsigned long long state, int to, int cells) {
+    int blank = 0;
+    for(int i = 0; i < cells; i++) {
+        if(((state >> (4*i)) & 0xF) == 0) blank = i;
+    }
+    unsigned long long tile = (state >> (4*to)) & 0xF;
+    return (state & ~(0xFULL << (4*to))) | (tile << (4*blank));
+}
+
+// ===================================
+// Open the log and start the writer
+// ===================================
+ExpansionRecorder::ExpansionRecorder(const string &fileName, int side)
+    : out(fileName.c_str(), ios::binary), side(side), ring(RING_SIZE), head(0), tail(0), done(false) {
+    if(!out.is_open()) return;
+    out.write(LOG_MAGIC, 4);
+    out.put(LOG_VERSION);
+    out.put((char)side);
+    buffer.reserve(FLUSH_SIZE + 64);
+    writer = thread(&ExpansionRecorder::writerLoop, this);
+}
+
+ExpansionRecorder::~ExpansionRecorder() {
+    if(!writer.joinable()) return;
+    done.store(true, memory_order_release);
+    writer.join();
+    out.close();
+}
+
+// =========================================================================
+// Producer side of the ring buffer: fill the slot, then publish it by
+// moving tail. If the ring is full we wait on the writer rather than lose
+// records, a replay with holes in it isn't much use
+// =========================================================================
+void ExpansionRecorder::record(unsigned long long state, unsigned long long gn, unsigned int hn, long long parent) {
+    if(!writer.joinable()) return;
+    size_t t = tail.load(memory_order_relaxed);
+    while(t - head.load(memory_order_acquire) >= RING_SIZE) this_thread::yield();
+    ExpansionRecord &slot = ring[t & (RING_SIZE-1)];
+    slot.state = state;
+    slot.gn = gn;
+    slot.hn = hn;
+    slot.parent = parent;
+    tail.store(t+1, memory_order_release);
+}
+
+// ============================================================
+// Consumer side: encode everything published so far, nap when
+// there's nothing to do, finish once done is set and drained
+// ============================================================
+void ExpansionRecorder::writerLoop() {
+    while(true) {
+        bool finishing = done.load(memory_order_acquire);
+        size_t h = head.load(memory_order_relaxed);
+        size_t t = tail.load(memory_order_acquire);
+        if(h == t) {
+            if(finishing) break;
+            this_thread::sleep_for(chrono::microseconds(500));
+            continue;
+        }
+        for(; h != t; h++) {
+            encode(ring[h & (RING_SIZE-1)]);
+            if(buffer.size() >= FLUSH_SIZE) {
+                out.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+        head.store(h, memory_order_release);
+    }
+    out.write(buffer.data(), buffer.size());
+    buffer.clear();
+    out.flush();
+}
+
+// Base-128 varint, low bits first
+static void putVarint(string &buffer, unsigned long long value) {
+    while(value >= 0x80) {
+        buffer.push_back((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char)value);
+}
+
+// ==============================================
+// Append one record in the format from recorder.h
+// ==============================================
+void ExpansionRecorder::encode(const ExpansionRecord &rec) {
+    long long id = states.size();
+    int cells = side * side;
+    bool hasParent = rec.parent >= 0 && rec.parent < id;
+    unsigned long long parentG = hasParent ? depths[rec.parent] : 0;
+    
+    putVarint(buffer, id - (hasParent ? rec.parent : -1));
+    int move = hasParent ? slideTarget(states[rec.parent], rec.state, cells) : -1;
+    if(move >= 0) buffer.push_back((char)move);
+    else {
+        buffer.push_back((char)FULL_STATE);
+        for(int i = 0; i < 8; i++) buffer.push_back((char)((rec.state >> (8*i)) & 0xFF));
+    }
+    long long dg = (long long)rec.gn - (long long)parentG - (hasParent ? 1 : 0);
+    putVarint(buffer, ((unsigned long long)dg << 1) ^ (unsigned long long)(dg >> 63));  // zigzag
+    putVarint(buffer, rec.hn);
+    
+    states.push_back(rec.state);
+    depths.push_back(rec.gn);
+}
+
+// ===========================
+// Open a log and check header
+// ===========================
+ExpansionLogReader::ExpansionLogReader(const string &fileName)
+    : in(fileName.c_str(), ios::binary), valid(false), side(0) {
+    char header[6];
+    if(!in.read(header, 6)) return;
+    for(int i = 0; i < 4; i++) {
+        if(header[i] != LOG_MAGIC[i]) return;
+    }
+    if(header[4] != LOG_VERSION) return;
+    side = header[5];
+    valid = side > 0 && side <= 4;
+}
+
+bool ExpansionLogReader::readVarint(unsigned long long &value) {
+    value = 0;
+    for(int shift = 0; shift < 64; shift += 7) {
+        int c = in.get();
+        if(c == EOF) return false;
+        value |= (unsigned long long)(c & 0x7F) << shift;
+        if(!(c & 0x80)) return true;
+    }
+    return false;
+}
+
+// ===============================================
+// Decode the next record, rebuilding the full
+// state and g(n) from the parent's record
+// ===============================================
+bool ExpansionLogReader::next(ExpansionRecord &rec) {
+    if(!valid) return false;
+    long long id = states.size();
+    unsigned long long delta, dg, hn;
+    if(!readVarint(delta)) return false;
+    rec.parent = id - (long long)delta;
+    bool hasParent = rec.parent >= 0;
+    if(rec.parent >= id) return false;
+    
+    int move = in.get();
+    if(move == EOF) return false;
+    if(move == FULL_STATE) {
+        unsigned char bytes[8];
+        if(!in.read((char *)bytes, 8)) return false;
+        rec.state = 0;
+        for(int i = 0; i < 8; i++) rec.state |= (unsigned long long)bytes[i] << (8*i);
+    }
+    else if(hasParent) rec.state = applySlide(states[rec.parent], move, side*side);
+    else return false;
+    
+    if(!readVarint(dg) || !readVarint(hn)) return false;
+    long long g = (long long)(dg >> 1) ^ -(long long)(dg & 1);
+    rec.gn = g + (hasParent ? depths[rec.parent] + 1 : 0);
+    rec.hn = hn;
+    
+    states.push_back(rec.state);
+    depths.push_back(rec.gn);
+    return true;
+}
@@ -0,0 +1,84 @@
+/* 
+ * File:   recorder.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Binary recording of every node the search expands, in expansion order
+// The search thread drops records into a single-producer/single-consumer
+// lock-free ring buffer and a writer thread encodes them into the log file.
+//
+// Log format (all integers are little-endian base-128 varints):
+//   "ASXL" magic, version byte, board side byte
+//   then per expansion, with id = position in the log starting at 0:
+//     id - parent          (parent is -1 for the initial state)
+//     move byte            cell the blank moved to from the parent state,
+//                          or 0xFF followed by the full 8 byte packed state
+//     zigzag(g - parent g - 1)
+//     h
+// Since nearly every record is a single slide from its parent this comes out
+// to 4-6 bytes per expansion
+
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct ExpansionRecord {
+    unsigned long long state;   // Packed state, 4 bits per cell
+    unsigned long long gn;
+    unsigned int hn;
+    long long parent;           // Id of the parent's record, -1 for the root
+};
+
+class ExpansionRecorder {
+    public:
+    ExpansionRecorder(const std::string &fileName, int side);
+    ~ExpansionRecorder();   // Drains the ring buffer and closes the log
+    
+    bool isOpen() const { return out.is_open(); }
+    // Called by the search thread, only blocks if the writer falls a whole ring behind
+    void record(unsigned long long state, unsigned long long gn, unsigned int hn, long long parent);
+    
+    private:
+    void writerLoop();
+    void encode(const ExpansionRecord &rec);
+    
+    std::ofstream out;
+    int side;
+    std::vector<ExpansionRecord> ring;      // Size is a power of 2
+    std::atomic<size_t> head;               // Next slot the writer reads
+    std::atomic<size_t> tail;               // Next slot the search writes
+    std::atomic<bool> done;
+    std::thread writer;
+    // Writer thread only
+    std::vector<unsigned long long> states; // Every recorded state and g(n), to delta
+    std::vector<unsigned long long> depths; // encode children against their parents
+    std::string buffer;
+};
+
+// Reads a log back one record at a time
+class ExpansionLogReader {
+    public:
+    explicit ExpansionLogReader(const std::string &fileName);
+    
+    bool isOpen() const { return valid; }
+    int boardSide() const { return side; }
+    bool next(ExpansionRecord &rec);    // False at the end of the log (or on a truncated record)
+    
+    private:
+    bool readVarint(unsigned long long &value);
+    
+    std::ifstream in;
+    bool valid;
+    int side;
+    std::vector<unsigned long long> states;
+    std::vector<unsigned long long> depths;
+};
+
+#endif /* RECORDER_H */
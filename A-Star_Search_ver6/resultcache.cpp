@@ -0,0 +1,111 @@
+/* 
+ * File:   resultcache.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include "resultcache.h"
+#include "symmetry.h"
+using namespace std;
+
+ResultCache::ResultCache(size_t capacity, bool symmetry, int shards, int side)
+    : symmetry(symmetry), side(side), hitCount(0), missCount(0) {
+    // No more shards than boards, every shard has to be able to hold one
+    if(capacity == 0) capacity = 1;
+    shardCount = shards > 0 ? shards : 1;
+    if((size_t)shardCount > capacity) shardCount = capacity;
+    this->shards.reset(new Shard[shardCount]);
+    // The first few shards take the leftover boards
+    for(int i = 0; i < shardCount; i++) {
+        this->shards[i].capacity = capacity / shardCount + ((size_t)i < capacity % shardCount);
+    }
+}
+
+ResultCache::Shard &ResultCache::shardFor(unsigned long long key) {
+    return shards[(key * 0x9E3779B97F4A7C15ULL >> 32) % shardCount];
+}
+
+// ==================================================================
+// Up and left swap places in a mirror image, so do right and down
+// ==================================================================
+static void mirrorMoves(string &moves) {
+    for(size_t i = 0; i < moves.size(); i++) {
+        switch(moves[i]) {
+            case 'U': moves[i] = 'L'; break;
+            case 'L': moves[i] = 'U'; break;
+            case 'R': moves[i] = 'D'; break;
+            case 'D': moves[i] = 'R'; break;
+        }
+    }
+}
+
+bool ResultCache::lookup(unsigned long long packed, CachedSolution &out) {
+    bool reflected = false;
+    unsigned long long key = symmetry ? canonicalState(packed, &reflected, side) : packed;
+    Shard &shard = shardFor(key);
+    {
+        lock_guard<mutex> guard(shard.lock);
+        unordered_map<unsigned long long, list<Entry>::iterator>::iterator found = shard.index.find(key);
+        if(found == shard.index.end()) {
+            missCount.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+        // Back to the front of the line
+        shard.order.splice(shard.order.begin(), shard.order, found->second);
+        out = found->second->solution;
+    }
+    hitCount.fetch_add(1, memory_order_relaxed);
+    if(reflected) mirrorMoves(out.moves);
+    return true;
+}
+
+void ResultCache::store(unsigned long long packed, const CachedSolution &solution) {
+    bool reflected = false;
+    unsigned long long key = symmetry ? canonicalState(packed, &reflected, side) : packed;
+    Entry entry;
+    entry.key = key;
+    entry.solution = solution;
+    if(reflected) mirrorMoves(entry.solution.moves);
+    Shard &shard = shardFor(key);
+    lock_guard<mutex> guard(shard.lock);
+    unordered_map<unsigned long long, list<Entry>::iterator>::iterator found = shard.index.find(key);
+    if(found != shard.index.end()) {
+        found->second->solution = entry.solution;
+        shard.order.splice(shard.order.begin(), shard.order, found->second);
+        return;
+    }
+    if(shard.order.size() >= shard.capacity) {
+        shard.index.erase(shard.order.back().key);
+        shard.order.pop_back();
+    }
+    shard.order.push_front(entry);
+    shard.index[key] = shard.order.begin();
+}
+
+bool ResultCache::claim(const string &owner) {
+    lock_guard<mutex> guard(ownerLock);
+    if(this->owner.empty()) this->owner = owner;
+    return this->owner == owner;
+}
+
+void ResultCache::clear() {
+    for(int i = 0; i < shardCount; i++) {
+        lock_guard<mutex> guard(shards[i].lock);
+        shards[i].order.clear();
+        shards[i].index.clear();
+    }
+    hitCount.store(0, memory_order_relaxed);
+    missCount.store(0, memory_order_relaxed);
+    lock_guard<mutex> guard(ownerLock);
+    owner.clear();
+}
+
+size_t ResultCache::size() {
+    size_t total = 0;
+    for(int i = 0; i < shardCount; i++) {
+        lock_guard<mutex> guard(shards[i].lock);
+        total += shards[i].order.size();
+    }
+    return total;
+}
@@ -0,0 +1,80 @@
+/* 
+ * File:   resultcache.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Solved board cache
+// Remembers the depth and moves of recently solved boards so a board that
+// comes up again is answered without searching. Least recently used boards
+// are dropped once it's full. It's split into shards, each with its own
+// lock and its own slice of the capacity, picked by hashing the board, so
+// threads solving different boards hardly ever wait on each other.
+// With symmetry on, a board and its mirror image (see symmetry.h) share one
+// entry. The moves are stored for whichever one is the key and mirrored on
+// the way out, since the mirror of an up move is a left move and so on.
+// Only proven shortest solutions belong in here (solve() checks), so a hit
+// is as good as searching. A cache still sticks to the first search mode and
+// heuristic that claim() it, so one caller's stats don't quietly mix with
+// another's.
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "puzzle.h"
+
+struct CachedSolution {
+    unsigned long long depth;
+    std::string moves;      // Blank moves, U/R/D/L (see output.h)
+};
+
+class ResultCache {
+    public:
+    // capacity is the most boards kept across all shards
+    ResultCache(size_t capacity, bool symmetry = false, int shards = 16, int side = SIDE);
+    ResultCache(const ResultCache &) = delete;
+    ResultCache &operator=(const ResultCache &) = delete;
+    
+    // Fill in out and return true if packed (packState() layout) is cached
+    bool lookup(unsigned long long packed, CachedSolution &out);
+    void store(unsigned long long packed, const CachedSolution &solution);
+    // True if owner (eg. "astar/3") may use the cache, the first one to ask gets it
+    bool claim(const std::string &owner);
+    // Empties the cache and lets anyone claim it again
+    void clear();
+    
+    unsigned long long hits() const { return hitCount.load(std::memory_order_relaxed); }
+    unsigned long long misses() const { return missCount.load(std::memory_order_relaxed); }
+    size_t size();
+    int boardSide() const { return side; }
+    
+    private:
+    struct Entry {
+        unsigned long long key;
+        CachedSolution solution;
+    };
+    struct Shard {
+        std::mutex lock;
+        size_t capacity;
+        std::list<Entry> order;     // Most recently used first
+        std::unordered_map<unsigned long long, std::list<Entry>::iterator> index;
+    };
+    Shard &shardFor(unsigned long long key);
+    
+    bool symmetry;
+    int side;
+    int shardCount;
+    std::unique_ptr<Shard[]> shards;
+    std::mutex ownerLock;
+    std::string owner;          // Empty until claimed
+    std::atomic<unsigned long long> hitCount, missCount;
+};
+
+#endif /* RESULTCACHE_H */
@@ -0,0 +1,186 @@
+/* 
+ * File:   simd.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <cstdlib>
+#include "simd.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+using namespace std;
+
+typedef void (*BatchKernel)(const unsigned long long *, int, const short, unsigned short *);
+
+// [ver][tile][cell] contribution of a tile sitting in a cell: 0 for the
+// blank and for a tile that's home, otherwise 1 (misplaced tiles) or its
+// Manhattan distance home. Tile t belongs in cell t-1
+struct ScalarTables {
+    unsigned char cost[4][16][CELLS];
+    
+    ScalarTables() : cost() {
+        for(int tile = 1; tile < 16; tile++) {
+            for(int cell = 0; cell < CELLS; cell++) {
+                if(tile == cell+1) continue;
+                cost[2][tile][cell] = 1;
+                cost[3][tile][cell] = abs((tile-1) % SIDE - cell % SIDE) + abs((tile-1) / SIDE - cell / SIDE);
+            }
+        }
+    }
+};
+static const ScalarTables scalarTables;
+
+// ====================================================================
+// One state at a time, one table lookup per cell off the packed nibbles
+// ====================================================================
+void batchHeuristicScalar(const unsigned long long *states, int count, const short ver, unsigned short *out) {
+    if(ver != 2 && ver != 3) {
+        for(int i = 0; i < count; i++) out[i] = 0;
+        return;
+    }
+    const unsigned char (*cost)[CELLS] = scalarTables.cost[ver];
+    for(int i = 0; i < count; i++) {
+        unsigned long long packed = states[i];
+        int hn = 0;
+        for(int cell = 0; cell < CELLS; cell++) hn += cost[(packed >> (4*cell)) & 0xF][cell];
+        out[i] = hn;
+    }
+}
+
+#ifdef HAVE_X86_KERNELS
+// Byte constants the kernels share: goal column/row of each tile (index by
+// tile, for pshufb), column/row of each cell, and tile that belongs there
+struct SimdTables {
+    unsigned char goalX[16], goalY[16], cellX[16], cellY[16], home[16];
+    
+    SimdTables() {
+        for(int i = 0; i < 16; i++) {
+            goalX[i] = i ? (i-1) % SIDE : 0;
+            goalY[i] = i ? (i-1) / SIDE : 0;
+            cellX[i] = i % SIDE;
+            cellY[i] = i / SIDE;
+            // Cells past the board never hold a tile, 0xFF never matches
+            home[i] = i < CELLS ? i+1 : 0xFF;
+        }
+    }
+};
+static const SimdTables tables;
+
+// =====================================================================
+// Spread the 16 nibbles of a packed state into 16 bytes, cell i in byte i
+// =====================================================================
+__attribute__((target("ssse3")))
+static inline __m128i spreadNibbles(unsigned long long packed) {
+    const __m128i low = _mm_set1_epi8(0x0F);
+    __m128i bytes = _mm_cvtsi64_si128(packed);
+    __m128i even = _mm_and_si128(bytes, low);
+    __m128i odd = _mm_and_si128(_mm_srli_epi16(bytes, 4), low);
+    return _mm_unpacklo_epi8(even, odd);
+}
+
+__attribute__((target("ssse3")))
+static void batchHeuristicSSSE3(const unsigned long long *states, int count, const short ver, unsigned short *out) {
+    if(ver != 2 && ver != 3) {
+        batchHeuristicScalar(states, count, ver, out);
+        return;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i goalX = _mm_loadu_si128((const __m128i *)tables.goalX);
+    const __m128i goalY = _mm_loadu_si128((const __m128i *)tables.goalY);
+    const __m128i cellX = _mm_loadu_si128((const __m128i *)tables.cellX);
+    const __m128i cellY = _mm_loadu_si128((const __m128i *)tables.cellY);
+    const __m128i home = _mm_loadu_si128((const __m128i *)tables.home);
+    for(int i = 0; i < count; i++) {
+        __m128i tiles = spreadNibbles(states[i]);
+        // Cells holding a tile that isn't home, 0xFF each
+        __m128i away = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(tiles, zero), _mm_cmpeq_epi8(tiles, home)),
+                                        _mm_set1_epi8(-1));
+        __m128i dist;
+        if(ver == 2) dist = _mm_and_si128(away, one);
+        else {
+            __m128i dx = _mm_abs_epi8(_mm_sub_epi8(_mm_shuffle_epi8(goalX, tiles), cellX));
+            __m128i dy = _mm_abs_epi8(_mm_sub_epi8(_mm_shuffle_epi8(goalY, tiles), cellY));
+            dist = _mm_and_si128(away, _mm_add_epi8(dx, dy));
+        }
+        __m128i sums = _mm_sad_epu8(dist, zero);
+        out[i] = _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+    }
+}
+
+// ===========================================================================
+// Same thing two states at a time, one per 128-bit lane (pshufb and psadbw
+// work lane by lane, so the tables are just repeated in both halves)
+// ===========================================================================
+__attribute__((target("avx2")))
+static void batchHeuristicAVX2(const unsigned long long *states, int count, const short ver, unsigned short *out) {
+    if(ver != 2 && ver != 3) {
+        batchHeuristicScalar(states, count, ver, out);
+        return;
+    }
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i goalX = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables.goalX));
+    const __m256i goalY = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables.goalY));
+    const __m256i cellX = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables.cellX));
+    const __m256i cellY = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables.cellY));
+    const __m256i home = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables.home));
+    int i = 0;
+    for(; i + 2 <= count; i += 2) {
+        // State i in the low lane, state i+1 in the high one
+        __m256i bytes = _mm256_set_epi64x(0, (long long)states[i+1], 0, (long long)states[i]);
+        __m256i even = _mm256_and_si256(bytes, low);
+        __m256i odd = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), low);
+        __m256i tiles = _mm256_unpacklo_epi8(even, odd);
+        __m256i away = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi8(tiles, zero),
+                                                           _mm256_cmpeq_epi8(tiles, home)),
+                                           _mm256_set1_epi8(-1));
+        __m256i dist;
+        if(ver == 2) dist = _mm256_and_si256(away, one);
+        else {
+            __m256i dx = _mm256_abs_epi8(_mm256_sub_epi8(_mm256_shuffle_epi8(goalX, tiles), cellX));
+            __m256i dy = _mm256_abs_epi8(_mm256_sub_epi8(_mm256_shuffle_epi8(goalY, tiles), cellY));
+            dist = _mm256_and_si256(away, _mm256_add_epi8(dx, dy));
+        }
+        // One 64-bit partial sum per half lane: [0]+[1] is state i, [2]+[3] state i+1
+        __m256i sums = _mm256_sad_epu8(dist, zero);
+        out[i] = _mm256_extract_epi16(sums, 0) + _mm256_extract_epi16(sums, 4);
+        out[i+1] = _mm256_extract_epi16(sums, 8) + _mm256_extract_epi16(sums, 12);
+    }
+    if(i < count) batchHeuristicSSSE3(states + i, count - i, ver, out + i);
+}
+#endif
+
+// ========================================================
+// Pick the best kernel this CPU can run, once, on first use
+// ========================================================
+static BatchKernel pickKernel(const char **name) {
+#ifdef HAVE_X86_KERNELS
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        *name = "AVX2";
+        return batchHeuristicAVX2;
+    }
+    if(__builtin_cpu_supports("ssse3")) {
+        *name = "SSSE3";
+        return batchHeuristicSSSE3;
+    }
+#endif
+    *name = "scalar";
+    return batchHeuristicScalar;
+}
+
+static const char *kernelName = "";
+static const BatchKernel kernel = pickKernel(&kernelName);
+
+void batchHeuristic(const unsigned long long *states, int count, const short ver, unsigned short *out) {
+    kernel(states, count, ver, out);
+}
+
+const char *batchKernelName() {
+    return kernelName;
+}
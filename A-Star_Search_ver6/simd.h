@@ -0,0 +1,30 @@
+/* 
+ * File:   simd.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Heuristics for a whole batch of packed states at once
+// Each state's 9 nibbles are spread into the bytes of one SSE register
+// (one cell per byte), the goal column/row of every tile is looked up with
+// a byte shuffle (pshufb), and the per cell distances are summed with psadbw.
+// AVX2 does two states per instruction, SSSE3 one, and there's a plain
+// scalar loop for everything else. Which one runs is picked at runtime from
+// what the CPU supports, so one binary works everywhere.
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "puzzle.h"
+
+// out[i] = heuristic() version ver of states[i] (packed with packState())
+void batchHeuristic(const unsigned long long *states, int count, const short ver, unsigned short *out);
+
+// Name of the kernel batchHeuristic() picked on this CPU
+const char *batchKernelName();
+
+// The scalar kernel on its own, to benchmark and check the others against
+void batchHeuristicScalar(const unsigned long long *states, int count, const short ver, unsigned short *out);
+
+#endif /* SIMD_H */
@@ -0,0 +1,285 @@
+/* 
+ * File:   sma.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <set>
+#include <tuple>
+#include "sma.h"
+#include "util.h"
+using namespace std;
+
+const unsigned long long INF = ULLONG_MAX;
+
+// A node in the SMA* search tree, kept in a pool and linked by index
+struct SmaNode {
+    Node node;
+    unsigned long long state;       // packState(node), for the cycle and duplicate checks
+    unsigned long long f;           // Backed up f(n)
+    unsigned long long forgotten;   // Lowest f(n) of the children dropped to make room, INF if none
+    int parent;                     // Pool index, -1 for the start
+    int children[4];                // Pool indexes of the children still in memory
+    int childCount;
+    bool expanded;                  // Generated its successors at least once
+    bool inOpen, inLeaves;
+    unsigned long long openKey, leafKey;    // What it's filed under in each set
+};
+
+// (key, -depth, index): the front of open is the lowest key with the deepest
+// node winning ties, the back of leaves is the highest f with the shallowest
+// node winning ties, which is exactly the one SMA* wants to forget
+typedef tuple<unsigned long long, long long, int> SmaKey;
+
+class SmaSearch {
+    public:
+    SmaSearch(short algorithm, unsigned long long nodeCap) : algorithm(algorithm), nodeCap(nodeCap), count(0) {}
+    SearchResult run(const Node &start, const SearchBudget &budget, vector<Node> &path);
+    
+    private:
+    int allocate();
+    void release(int i);
+    void fileOpen(int i, unsigned long long key);
+    void unfileOpen(int i);
+    void fileLeaf(int i);
+    void unfileLeaf(int i);
+    void expand(int b);
+    bool pruneWorstLeaf(int keep);
+    void backup(int i);
+    bool onPath(int i, unsigned long long state);
+    
+    short algorithm;
+    unsigned long long nodeCap;
+    unsigned long long count;       // Nodes currently in memory
+    vector<SmaNode> pool;
+    vector<int> freeSlots;
+    set<SmaKey> open;               // Nodes with successors not in memory
+    set<SmaKey> leaves;             // Nodes with no children in memory
+    Node goal;
+};
+
+int SmaSearch::allocate() {
+    count++;
+    if(!freeSlots.empty()) {
+        int i = freeSlots.back();
+        freeSlots.pop_back();
+        return i;
+    }
+    pool.push_back(SmaNode());
+    return pool.size() - 1;
+}
+
+void SmaSearch::release(int i) {
+    count--;
+    freeSlots.push_back(i);
+}
+
+void SmaSearch::fileOpen(int i, unsigned long long key) {
+    unfileOpen(i);
+    pool[i].openKey = key;
+    pool[i].inOpen = true;
+    open.insert(SmaKey(key, -(long long)pool[i].node.gn, i));
+}
+
+void SmaSearch::unfileOpen(int i) {
+    if(!pool[i].inOpen) return;
+    open.erase(SmaKey(pool[i].openKey, -(long long)pool[i].node.gn, i));
+    pool[i].inOpen = false;
+}
+
+void SmaSearch::fileLeaf(int i) {
+    unfileLeaf(i);
+    pool[i].leafKey = pool[i].f;
+    pool[i].inLeaves = true;
+    leaves.insert(SmaKey(pool[i].f, -(long long)pool[i].node.gn, i));
+}
+
+void SmaSearch::unfileLeaf(int i) {
+    if(!pool[i].inLeaves) return;
+    leaves.erase(SmaKey(pool[i].leafKey, -(long long)pool[i].node.gn, i));
+    pool[i].inLeaves = false;
+}
+
+// ==========================================================
+// True if state is node i or one of its ancestors, children
+// that loop back onto their own path are never worth making
+// ==========================================================
+bool SmaSearch::onPath(int i, unsigned long long state) {
+    for(; i >= 0; i = pool[i].parent) {
+        if(pool[i].state == state) return true;
+    }
+    return false;
+}
+
+// ===========================================================================
+// Make room by forgetting the worst leaf (anything but keep or the start).
+// Its parent remembers the lowest f(n) it has forgotten and goes back into
+// open so the branch can be regenerated if it ever looks best again
+// ===========================================================================
+bool SmaSearch::pruneWorstLeaf(int keep) {
+    set<SmaKey>::reverse_iterator it = leaves.rbegin();
+    while(it != leaves.rend() && (get<2>(*it) == keep || pool[get<2>(*it)].parent < 0)) ++it;
+    if(it == leaves.rend()) return false;
+    
+    int w = get<2>(*it);
+    int p = pool[w].parent;
+    unfileLeaf(w);
+    unfileOpen(w);
+    SmaNode &parent = pool[p];
+    for(int c = 0; c < parent.childCount; c++) {
+        if(parent.children[c] == w) {
+            parent.children[c] = parent.children[--parent.childCount];
+            break;
+        }
+    }
+    parent.forgotten = min(parent.forgotten, pool[w].f);
+    release(w);
+    
+    fileOpen(p, parent.forgotten);
+    if(parent.childCount == 0 && p != keep) fileLeaf(p);
+    backup(p);
+    return true;
+}
+
+// =========================================================================
+// f(n) of an expanded node is the best of its children, counting forgotten
+// ones. Pass changes up the tree until nothing changes
+// =========================================================================
+void SmaSearch::backup(int i) {
+    while(i >= 0 && pool[i].expanded) {
+        SmaNode &n = pool[i];
+        unsigned long long best = n.forgotten;
+        for(int c = 0; c < n.childCount; c++) best = min(best, pool[n.children[c]].f);
+        if(best == n.f) return;
+        n.f = best;
+        if(n.inLeaves) fileLeaf(i);     // Refile under the new f
+        i = n.parent;
+    }
+}
+
+// ==========================================================================
+// Generate every successor of b that isn't already in memory. f(n) of each
+// child is at least what b was filed under (pathmax), and a child too deep
+// for its whole path to fit in memory can never be part of an answer
+// ==========================================================================
+void SmaSearch::expand(int b) {
+    unfileOpen(b);
+    unfileLeaf(b);
+    unsigned long long bKey = pool[b].expanded ? pool[b].forgotten : pool[b].f;
+    pool[b].forgotten = INF;     // Everything missing is about to be regenerated
+    
+    Node children[4];
+    int n = generateChildren(pool[b].node, children);
+    for(int c = 0; c < n; c++) {
+        unsigned long long state = packState(children[c]);
+        bool present = onPath(b, state);
+        for(int k = 0; k < pool[b].childCount && !present; k++) {
+            present = pool[pool[b].children[k]].state == state;
+        }
+        if(present) continue;
+        
+        children[c].hn = heuristic(children[c], algorithm);
+        unsigned long long f = max(children[c].gn + children[c].hn, bKey);
+        if(children[c].gn >= nodeCap - 1 && !testState(goal, children[c])) f = INF;
+        
+        // No room and nothing else to drop, so this child is forgotten right away
+        while(count >= nodeCap) {
+            if(!pruneWorstLeaf(b)) break;
+        }
+        if(count >= nodeCap) {
+            pool[b].forgotten = min(pool[b].forgotten, f);
+            continue;
+        }
+        
+        int i = allocate();
+        SmaNode &child = pool[i];
+        child.node = children[c];
+        child.state = state;
+        child.f = f;
+        child.forgotten = INF;
+        child.parent = b;
+        child.childCount = 0;
+        child.expanded = false;
+        child.inOpen = child.inLeaves = false;
+        pool[b].children[pool[b].childCount++] = i;
+        fileOpen(i, f);
+        fileLeaf(i);
+    }
+    
+    pool[b].expanded = true;
+    if(pool[b].forgotten != INF) fileOpen(b, pool[b].forgotten);
+    if(pool[b].childCount == 0) {
+        // Dead end (every move loops back onto the path) unless something was forgotten
+        if(pool[b].forgotten == INF) pool[b].f = INF;
+        fileLeaf(b);
+    }
+    backup(b);
+}
+
+// ============================================================
+// Main loop: expand the best node until the goal comes out on
+// top, the budget runs out or nothing fits in memory any more
+// ============================================================
+SearchResult SmaSearch::run(const Node &start, const SearchBudget &budget, vector<Node> &path) {
+    SearchResult result;
+    long long startTime = nowMicros();
+    goal = goalNode();
+    if(nodeCap < 2) nodeCap = 2;
+    
+    int root = allocate();
+    pool[root].node = start;
+    pool[root].node.hn = heuristic(start, algorithm);
+    pool[root].state = packState(start);
+    pool[root].f = pool[root].node.gn + pool[root].node.hn;
+    pool[root].forgotten = INF;
+    pool[root].parent = -1;
+    pool[root].childCount = 0;
+    pool[root].expanded = false;
+    pool[root].inOpen = pool[root].inLeaves = false;
+    fileOpen(root, pool[root].f);
+    fileLeaf(root);
+    
+    result.status = NO_SOLUTION;
+    while(!open.empty()) {
+        int b = get<2>(*open.begin());
+        unsigned long long key = get<0>(*open.begin());
+        // Every remaining path is too long to fit in memory
+        if(key == INF) {
+            result.status = MEMORY_EXCEEDED;
+            break;
+        }
+        result.lowerBound = max(result.lowerBound, key);
+        if(!pool[b].expanded && testState(goal, pool[b].node)) {
+            result.status = SOLVED;
+            result.depth = pool[b].node.gn;
+            for(int i = b; i >= 0; i = pool[i].parent) path.push_back(pool[i].node);
+            reverse(path.begin(), path.end());
+            break;
+        }
+        publishCounters(budget, result.expansions, key, open.size(), count);
+        SearchStatus status = checkBudget(budget, startTime, result.expansions, count * sizeof(SmaNode));
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            break;
+        }
+        expand(b);
+        result.expansions++;
+        result.maxQueueSize = max(result.maxQueueSize, (unsigned long long)open.size());
+    }
+    if(result.status == SOLVED) result.lowerBound = result.depth;
+    result.memoryBytes = count * sizeof(SmaNode);
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
+
+// ==========================================
+// Run SMA* holding at most nodeCap nodes
+// ==========================================
+SearchResult smaStar(const Node &start, const short algorithm, unsigned long long nodeCap,
+                     const SearchBudget &budget, vector<Node> &path) {
+    SmaSearch search(algorithm, nodeCap);
+    return search.run(start, budget, path);
+}
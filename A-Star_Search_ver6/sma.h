@@ -0,0 +1,25 @@
+/* 
+ * File:   sma.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// SMA* (simplified memory-bounded A*)
+// Works like A* until it holds nodeCap nodes, then makes room by forgetting
+// the worst leaf (highest f, shallowest) and backing its f(n) up into the
+// parent, so that branch gets regenerated later only if it becomes the best
+// option again. Optimal as long as the optimal solution path fits in nodeCap
+// nodes, and never holds more than nodeCap nodes regardless.
+
+#ifndef SMA_H
+#define SMA_H
+
+#include <vector>
+#include "puzzle.h"
+
+// path gets the solution, start first, when the search succeeds
+SearchResult smaStar(const Node &start, const short algorithm, unsigned long long nodeCap,
+                     const SearchBudget &budget, std::vector<Node> &path);
+
+#endif /* SMA_H */
@@ -0,0 +1,107 @@
+/* 
+ * File:   solvepool.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include "solvepool.h"
+#include "util.h"
+using namespace std;
+
+SolverPool::SolverPool(int threads) : stopping(false) {
+    if(threads <= 0) threads = thread::hardware_concurrency();
+    if(threads <= 0) threads = 1;
+    running.resize(threads);
+    for(int i = 0; i < threads; i++) workers.push_back(thread(&SolverPool::workerLoop, this, i));
+}
+
+SolverPool::~SolverPool() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+        for(size_t i = 0; i < jobs.size(); i++) jobs[i].token.cancel();
+        for(size_t i = 0; i < running.size(); i++) running[i].cancel();
+    }
+    wake.notify_all();
+    for(size_t i = 0; i < workers.size(); i++) workers[i].join();
+}
+
+future<SolveResult> SolverPool::submit(const vector<int> &board, const SolveOptions &options,
+                                       unsigned long long deadlineMs, CancelToken token) {
+    // std::function needs something it can copy, a promise can't be
+    shared_ptr<promise<SolveResult> > result = make_shared<promise<SolveResult> >();
+    submit(board, options, [result](const SolveResult &done) { result->set_value(done); }, deadlineMs, token);
+    return result->get_future();
+}
+
+void SolverPool::submit(const vector<int> &board, const SolveOptions &options, Callback done,
+                        unsigned long long deadlineMs, CancelToken token) {
+    Job job;
+    job.board = board;
+    job.options = options;
+    job.deadline = deadlineMs ? nowMicros() + (long long)deadlineMs * 1000 : 0;
+    job.token = token;
+    job.done = done;
+    {
+        lock_guard<mutex> guard(lock);
+        // Too late, still gets its answer so nobody waits forever
+        if(stopping) job.token.cancel();
+        jobs.push_back(job);
+    }
+    wake.notify_one();
+}
+
+size_t SolverPool::queued() {
+    lock_guard<mutex> guard(lock);
+    return jobs.size();
+}
+
+// ===================================================================
+// Take jobs until the pool is stopping and the queue has run dry (jobs
+// left over by then have been cancelled, so they go by quickly)
+// ===================================================================
+void SolverPool::workerLoop(size_t id) {
+    while(true) {
+        Job job;
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [this] { return stopping || !jobs.empty(); });
+            if(jobs.empty()) return;
+            job = jobs.front();
+            jobs.pop_front();
+            running[id] = job.token;
+        }
+        SolveResult result = run(job);
+        {
+            lock_guard<mutex> guard(lock);
+            running[id] = CancelToken();
+        }
+        job.done(result);
+    }
+}
+
+// ===================================================================
+// Fold the deadline and the token into the budget and solve. Anything
+// already cancelled or past its deadline isn't searched at all
+// ===================================================================
+SolveResult SolverPool::run(Job &job) {
+    SolveResult result;
+    SearchBudget &budget = job.options.budget;
+    // The caller's own budget.cancel stays in place, the token goes alongside it
+    budget.poolCancel = job.token.get();
+    if(budgetCancelled(budget)) {
+        result.stats.status = CANCELLED;
+        return result;
+    }
+    if(job.deadline) {
+        long long left = job.deadline - nowMicros();
+        if(left <= 0) {
+            result.stats.status = TIME_EXCEEDED;
+            return result;
+        }
+        unsigned long long leftMs = (left + 999) / 1000;
+        if(!budget.timeLimitMs || leftMs < budget.timeLimitMs) budget.timeLimitMs = leftMs;
+    }
+    return solve(job.board, job.options);
+}
@@ -0,0 +1,89 @@
+/* 
+ * File:   solvepool.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Asynchronous solving
+// A fixed set of worker threads pulling boards off one queue and running
+// solve() (eightpuzzle.h) on them, so the caller never waits on a search.
+// submit() hands back a future, or calls a callback on the worker thread
+// when it's done. Every request can have a deadline (counted from when it
+// was submitted, so time spent queued counts too) and a CancelToken. The
+// search checks the token with the rest of its budget (see checkBudget()),
+// next to any budget.cancel flag already in the options, so either one
+// stops it. A cancelled A* gives its node memory back straight away instead of
+// keeping it for the next board. A request cancelled before it starts is
+// never searched.
+
+#ifndef SOLVEPOOL_H
+#define SOLVEPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "eightpuzzle.h"
+
+// Shared flag, copies all cancel the same request
+class CancelToken {
+    public:
+    CancelToken() : flag(std::make_shared<std::atomic<bool> >(false)) {}
+    
+    void cancel() { flag->store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return flag->load(std::memory_order_relaxed); }
+    const std::atomic<bool> *get() const { return flag.get(); }
+    
+    private:
+    std::shared_ptr<std::atomic<bool> > flag;
+};
+
+class SolverPool {
+    public:
+    typedef std::function<void(const SolveResult &)> Callback;
+    
+    // threads <= 0 means one per core
+    explicit SolverPool(int threads = 0);
+    // Cancels everything still queued or running, waits for the workers
+    // to finish up (every future/callback still gets its CANCELLED result)
+    ~SolverPool();
+    SolverPool(const SolverPool &) = delete;
+    SolverPool &operator=(const SolverPool &) = delete;
+    
+    // deadlineMs from now, 0 for none. Missing the deadline ends the search
+    // as TIME_EXCEEDED, on top of whatever options.budget already says
+    std::future<SolveResult> submit(const std::vector<int> &board, const SolveOptions &options,
+                                    unsigned long long deadlineMs = 0, CancelToken token = CancelToken());
+    // Same, but done gets called on the worker thread with the result
+    void submit(const std::vector<int> &board, const SolveOptions &options, Callback done,
+                unsigned long long deadlineMs = 0, CancelToken token = CancelToken());
+    
+    int threadCount() const { return workers.size(); }
+    size_t queued();
+    
+    private:
+    struct Job {
+        std::vector<int> board;
+        SolveOptions options;
+        long long deadline;     // nowMicros() time, 0 for none
+        CancelToken token;
+        Callback done;
+    };
+    void workerLoop(size_t id);
+    static SolveResult run(Job &job);
+    
+    std::mutex lock;            // Guards everything below except workers
+    std::condition_variable wake;
+    std::deque<Job> jobs;
+    std::vector<CancelToken> running;   // Token of the job each worker is on
+    bool stopping;
+    std::vector<std::thread> workers;
+};
+
+#endif /* SOLVEPOOL_H */
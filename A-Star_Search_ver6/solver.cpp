@@ -0,0 +1,189 @@
+/* 
+ * File:   solver.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <algorithm>
+#include "bitboard.h"
+#include "prune.h"
+#include "solver.h"
+#include "util.h"
+using namespace std;
+
+const size_t SOLVER_INITIAL_SLOTS = 1 << 12;
+
+Solver::Solver(bool movePruning)
+    : allocationCount(0), records(CountingAllocator<Record>(&allocationCount)),
+      heap(Before(&records), CountingAllocator<int>(&allocationCount)), table(CountingAllocator<Slot>(&allocationCount)),
+      tableUsed(0), epoch(1), pruning(movePruning) {
+    table.assign(SOLVER_INITIAL_SLOTS, Slot());
+    for(size_t i = 0; i < table.size(); i++) table[i].epoch = 0;
+}
+
+// ===========================================================================
+// O(1): the vectors hold plain structs, so clearing them just resets the
+// size (the heap's handle map too, see IndexedHeap::reset()), and bumping
+// the epoch empties the table. Only when the epoch counter wraps around
+// (every 4 billion solves) do the stamps get wiped for real
+// ===========================================================================
+void Solver::reset() {
+    records.clear();
+    heap.reset();
+    tableUsed = 0;
+    if(++epoch == 0) {
+        for(size_t i = 0; i < table.size(); i++) table[i].epoch = 0;
+        epoch = 1;
+    }
+}
+
+// Back to how a new solver starts out
+void Solver::release() {
+    RecordVector(CountingAllocator<Record>(&allocationCount)).swap(records);
+    heap = Heap(Before(&records), CountingAllocator<int>(&allocationCount));
+    table.assign(SOLVER_INITIAL_SLOTS, Slot());
+    table.shrink_to_fit();
+    for(size_t i = 0; i < table.size(); i++) table[i].epoch = 0;
+    tableUsed = 0;
+    epoch = 1;
+}
+
+size_t Solver::memoryBytes() const {
+    return records.capacity() * sizeof(Record) + heap.capacityBytes() + table.capacity() * sizeof(Slot);
+}
+
+// Record index of a state seen this search, -1 if it hasn't been
+int Solver::find(unsigned long long state) const {
+    size_t mask = table.size() - 1;
+    for(size_t i = (state * 0x9E3779B97F4A7C15ULL >> 20) & mask; table[i].epoch == epoch; i = (i + 1) & mask) {
+        if(table[i].key == state) return table[i].record;
+    }
+    return -1;
+}
+
+void Solver::insert(unsigned long long state, int record) {
+    if((tableUsed + 1) * 2 > table.size()) grow();
+    size_t mask = table.size() - 1;
+    size_t i = (state * 0x9E3779B97F4A7C15ULL >> 20) & mask;
+    while(table[i].epoch == epoch) i = (i + 1) & mask;
+    table[i].key = state;
+    table[i].epoch = epoch;
+    table[i].record = record;
+    tableUsed++;
+}
+
+// Twice the slots, only ever happens while a solver is warming up
+void Solver::grow() {
+    CountingAllocator<Slot> counted(&allocationCount);
+    vector<Slot, CountingAllocator<Slot> > old(counted);
+    old.swap(table);
+    table.assign(old.size() * 2, Slot());
+    for(size_t i = 0; i < table.size(); i++) table[i].epoch = 0;
+    tableUsed = 0;
+    unsigned int current = epoch;
+    epoch = 1;
+    for(size_t i = 0; i < old.size(); i++) {
+        if(old[i].epoch == current) insert(old[i].key, old[i].record);
+    }
+}
+
+// Only for the observer, the search itself never needs one
+Node Solver::toNode(const Record &record) const {
+    Node node = unpackState(record.state);
+    node.gn = record.gn;
+    node.hn = record.hn;
+    node.fsm = record.fsm;
+    node.parent = record.parent;
+    return node;
+}
+
+bool Solver::Before::operator()(int lhs, int rhs) const {
+    const Record &a = (*records)[lhs], &b = (*records)[rhs];
+    if(a.gn + a.hn != b.gn + b.hn) return a.gn + a.hn < b.gn + b.hn;
+    return a.gn > b.gn;
+}
+
+SearchResult Solver::solve(unsigned long long start, const short algorithm, const SearchBudget &budget,
+                           vector<unsigned long long> &path, SearchObserver *observer) {
+    // Not movePruner(), see prune.h. Left alone entirely when pruning is off
+    const MovePruner *pruner = pruning ? &undoPruner() : NULL;
+    SearchResult result;
+    long long startTime = nowMicros();
+    unsigned long long goal = packState(goalNode());
+    reset();
+    path.clear();
+    
+    Node startNode = unpackState(start);
+    Record root;
+    root.state = start;
+    root.gn = 0;
+    root.hn = heuristic(startNode, algorithm);
+    root.blank = startNode.pos[0];
+    root.fsm = pruner ? pruner->start() : 0;
+    root.parent = -1;
+    records.push_back(root);
+    heap.push(0);
+    insert(start, 0);
+    if(observer) observer->discovered(toNode(root), 0);
+    
+    result.status = NO_SOLUTION;
+    while(!heap.empty()) {
+        result.maxQueueSize = max(result.maxQueueSize, (unsigned long long)heap.size());
+        int curr = heap.top();
+        heap.pop();
+        Record node = records[curr];
+        if(observer && (result.expansions == 0 || node.gn + node.hn > result.lowerBound)) {
+            observer->newBound(node.gn + node.hn);
+        }
+        result.lowerBound = max(result.lowerBound, (unsigned long long)node.gn + node.hn);
+        if(node.state == goal) {
+            result.status = SOLVED;
+            result.depth = result.lowerBound = node.gn;
+            for(int r = curr; r >= 0; r = records[r].parent) path.push_back(records[r].state);
+            reverse(path.begin(), path.end());
+            break;
+        }
+        publishCounters(budget, result.expansions, node.gn + node.hn, heap.size(), records.size() - heap.size());
+        SearchStatus status = checkBudget(budget, startTime, result.expansions, memoryBytes());
+        if(status != WITHIN_BUDGET) {
+            result.status = status;
+            break;
+        }
+        result.expansions++;
+        if(observer) observer->expanding(toNode(node), curr, node.parent, heap.size(), records.size() - heap.size());
+        
+        PackedChild children[4];
+        int n = packedChildren<SIDE>(node.state, node.blank, children);
+        for(int i = 0; i < n; i++) {
+            int fsm = pruner ? pruner->next(node.fsm, moveTable<SIDE>().dir[node.blank][i]) : 0;
+            if(fsm < 0) continue;
+            unsigned int gn = node.gn + 1;
+            int existing = find(children[i].state);
+            if(existing >= 0) {
+                // Closed, or already queued at least as cheaply
+                Record &seen = records[existing];
+                if(!heap.contains(existing) || seen.gn <= gn) continue;
+                seen.gn = gn;
+                seen.fsm = fsm;
+                seen.parent = curr;
+                heap.decreaseKey(existing);
+                continue;
+            }
+            Record child;
+            child.state = children[i].state;
+            child.gn = gn;
+            child.hn = node.hn + heuristicDelta(algorithm, children[i].tile, node.blank, i);
+            child.blank = children[i].blank;
+            child.fsm = fsm;
+            child.parent = curr;
+            records.push_back(child);
+            heap.push(records.size() - 1);
+            insert(child.state, records.size() - 1);
+            if(observer) observer->discovered(toNode(child), records.size() - 1);
+        }
+    }
+    result.memoryBytes = memoryBytes();
+    result.seconds = (nowMicros() - startTime) / 1e6;
+    return result;
+}
@@ -0,0 +1,113 @@
+/* 
+ * File:   solver.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Reusable A* solver
+// Owns everything a search needs (node storage, open list heap, closed
+// table) and keeps it between solves. Starting a new search is O(1): node
+// storage and the heap are just emptied, and the state table is stamped with
+// a new epoch so every old entry counts as empty without being touched. Once
+// a solver has seen its biggest search, solving more boards allocates
+// nothing. All of its memory comes through a counting allocator, so that's
+// easy to check.
+// Works on packed states with the move tables, h(n) updated one move at a
+// time, and undo move pruning (undoPruner()); ordered by f(n), then deeper
+// first. This is the A* behind solve() (eightpuzzle.h), so the command line
+// runs on it too, watching through a SearchObserver.
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include "heap.h"
+#include "puzzle.h"
+
+// std::allocator that also counts how many times it was asked for memory
+template <class T>
+class CountingAllocator {
+    public:
+    typedef T value_type;
+    
+    explicit CountingAllocator(unsigned long long *count) : count(count) {}
+    template <class U>
+    CountingAllocator(const CountingAllocator<U> &other) : count(other.count) {}
+    
+    T *allocate(size_t n) {
+        ++*count;
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, size_t) { ::operator delete(p); }
+    
+    template <class U>
+    bool operator==(const CountingAllocator<U> &other) const { return count == other.count; }
+    template <class U>
+    bool operator!=(const CountingAllocator<U> &other) const { return count != other.count; }
+    
+    unsigned long long *count;
+};
+
+class Solver {
+    public:
+    // movePruning off generates every move, like --no-move-pruning
+    explicit Solver(bool movePruning = true);
+    // Not copyable, the containers share the allocation counter
+    Solver(const Solver &) = delete;
+    Solver &operator=(const Solver &) = delete;
+    
+    // A* from a packed 3x3 board. path gets the solution (packed, start first).
+    // Record indices are the ids observer (if any) sees
+    SearchResult solve(unsigned long long start, const short algorithm, const SearchBudget &budget,
+                       std::vector<unsigned long long> &path, SearchObserver *observer = NULL);
+    
+    // Forget the last search, keep the memory. solve() does this itself
+    void reset();
+    // Forget the last search and give its memory back too
+    void release();
+    
+    // Heap allocations made by this solver since it was created
+    unsigned long long allocations() const { return allocationCount; }
+    size_t memoryBytes() const;
+    
+    private:
+    struct Record {
+        unsigned long long state;
+        unsigned int gn;
+        unsigned short hn;
+        unsigned char blank;
+        int fsm;
+        int parent;         // Record this one was reached from, -1 for the start
+    };
+    typedef std::vector<Record, CountingAllocator<Record> > RecordVector;
+    // Same order as cmpClass: lower f(n) first, then deeper first
+    struct Before {
+        explicit Before(const RecordVector *records = NULL) : records(records) {}
+        bool operator()(int lhs, int rhs) const;
+        const RecordVector *records;
+    };
+    typedef IndexedHeap<Before, 4, CountingAllocator<int> > Heap;
+    struct Slot {
+        unsigned long long key;
+        unsigned int epoch;     // Only an entry if it matches the solver's epoch
+        int record;
+    };
+    
+    Node toNode(const Record &record) const;
+    int find(unsigned long long state) const;
+    void insert(unsigned long long state, int record);
+    void grow();
+    
+    unsigned long long allocationCount;     // Has to come first, the containers point at it
+    RecordVector records;
+    Heap heap;                              // Record indices, ordered through records
+    std::vector<Slot, CountingAllocator<Slot> > table;  // Size is a power of 2
+    size_t tableUsed;
+    unsigned int epoch;
+    bool pruning;
+};
+
+#endif /* SOLVER_H */
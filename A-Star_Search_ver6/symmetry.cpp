@@ -0,0 +1,54 @@
+/* 
+ * File:   symmetry.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include "symmetry.h"
+using namespace std;
+
+// Board sizes the tables are built for (a packed state only holds up to 4x4)
+const int MAX_SIDE = 4;
+
+// For each side: where each cell goes, and what each tile gets renamed to
+struct ReflectTables {
+    unsigned char cell[MAX_SIDE+1][16];
+    unsigned char tile[MAX_SIDE+1][16];
+    
+    ReflectTables() {
+        for(int side = 1; side <= MAX_SIDE; side++) {
+            for(int i = 0; i < side*side; i++) {
+                cell[side][i] = (i % side) * side + i / side;
+                // Tile t lives in cell t-1, so it becomes the tile that lives
+                // where cell t-1 flips to. The blank stays the blank
+                tile[side][i] = i == 0 ? 0 : ((i-1) % side) * side + (i-1) / side + 1;
+            }
+        }
+    }
+};
+static const ReflectTables tables;
+
+unsigned long long reflectState(unsigned long long packed, int side) {
+    unsigned long long reflected = 0;
+    for(int i = 0; i < side*side; i++) {
+        unsigned long long tile = tables.tile[side][(packed >> (4*i)) & 0xF];
+        reflected |= tile << (4*tables.cell[side][i]);
+    }
+    return reflected;
+}
+
+unsigned long long canonicalState(unsigned long long packed, bool *reflected, int side) {
+    unsigned long long mirror = reflectState(packed, side);
+    if(reflected) *reflected = mirror < packed;
+    return mirror < packed ? mirror : packed;
+}
+
+Node reflectNode(const Node &node) {
+    Node mirror = unpackState(reflectState(packState(node)));
+    mirror.gn = node.gn;
+    mirror.hn = node.hn;
+    mirror.fsm = 0;     // Move history doesn't carry over, the moves got mirrored too
+    mirror.parent = node.parent;
+    return mirror;
+}
@@ -0,0 +1,38 @@
+/* 
+ * File:   symmetry.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Reflection about the main diagonal
+// Flipping a board over its top-left to bottom-right diagonal and renaming
+// every tile after the cell its goal cell flips to turns the goal back into
+// the goal, and any board into one exactly as many moves away from it. So
+// anything that only depends on the distance to the goal (learned h(n)
+// values, solved puzzle caches, distance tables) can store one entry for a
+// board and its mirror image, keyed by whichever packs smaller. Not for a
+// search's own closed list though, mirrored boards are different distances
+// from the start.
+// No heuristic does a reflected lookup (h(mirror) as a second value, or
+// tables with only one of each pair). Every heuristic table there is
+// (Manhattan and misplaced in moves.h and simd.cpp, h* in analysis.cpp)
+// already gives a board and its mirror the same value, so the second
+// lookup would never beat the first. That only starts paying off with
+// tables over some of the tiles (pattern databases), which we don't have.
+
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include "puzzle.h"
+
+// The mirror image of a packed state (packState() layout) on a side x side board
+unsigned long long reflectState(unsigned long long packed, int side = SIDE);
+
+// The smaller of a packed state and its mirror image, reflected says which one it was
+unsigned long long canonicalState(unsigned long long packed, bool *reflected = 0, int side = SIDE);
+
+// Same as reflectState() for a Node, g(n), h(n) and the rest are copied across
+Node reflectNode(const Node &node);
+
+#endif /* SYMMETRY_H */
@@ -0,0 +1,103 @@
+/* 
+ * File:   trace.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <chrono>
+#include "trace.h"
+#include "util.h"
+using namespace std;
+
+// Wake the writer early once this many events are waiting
+const size_t TRACE_BATCH = 4096;
+
+// ===================================================================
+// Open the trace file and start the writer thread
+// If the file can't be opened the writer just drops every event
+// ===================================================================
+TraceWriter::TraceWriter(const string &fileName)
+    : out(fileName.c_str()), startTime(nowMicros()), firstEvent(true), done(false) {
+    if(!out.is_open()) return;
+    pending.reserve(TRACE_BATCH * 2);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    // Name the search thread so the Perfetto track isn't just "tid 1"
+    out << "{\"ph\":\"M\",\"pid\":1,\"tid\":1,\"name\":\"thread_name\",\"args\":{\"name\":\"search\"}}";
+    firstEvent = false;
+    writer = thread(&TraceWriter::writerLoop, this);
+}
+
+// =========================================================
+// Tell the writer to drain the buffer, then close the JSON
+// =========================================================
+TraceWriter::~TraceWriter() {
+    if(!writer.joinable()) return;
+    {
+        lock_guard<mutex> guard(lock);
+        done = true;
+    }
+    wake.notify_one();
+    writer.join();
+    out << "\n]}\n";
+    out.close();
+}
+
+void TraceWriter::begin(const char *name) { push('B', name, NULL, 0); }
+void TraceWriter::end(const char *name) { push('E', name, NULL, 0); }
+void TraceWriter::instant(const char *name, const char *arg, long long value) { push('i', name, arg, value); }
+void TraceWriter::counter(const char *name, long long value) { push('C', name, name, value); }
+
+// ==========================================================================
+// Queue an event for the writer thread, this is the only part the search
+// thread pays for
+// ==========================================================================
+void TraceWriter::push(char phase, const char *name, const char *arg, long long value) {
+    if(!writer.joinable()) return;
+    Event e = { phase, name, arg, value, nowMicros() - startTime };
+    bool full;
+    {
+        lock_guard<mutex> guard(lock);
+        pending.push_back(e);
+        full = pending.size() >= TRACE_BATCH;
+    }
+    if(full) wake.notify_one();
+}
+
+// =======================================================================
+// Background thread: swap the pending buffer out every so often (or when
+// it fills up) and format it while the search keeps going
+// =======================================================================
+void TraceWriter::writerLoop() {
+    vector<Event> batch;
+    batch.reserve(TRACE_BATCH * 2);
+    bool finished = false;
+    while(!finished) {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait_for(guard, chrono::milliseconds(100),
+                          [this] { return done || pending.size() >= TRACE_BATCH; });
+            batch.swap(pending);
+            finished = done;
+        }
+        writeEvents(batch);
+        batch.clear();
+    }
+    out.flush();
+}
+
+// ==========================================
+// Format a batch of events as trace JSON
+// ==========================================
+void TraceWriter::writeEvents(const vector<Event> &events) {
+    for(size_t i = 0; i < events.size(); i++) {
+        const Event &e = events[i];
+        if(!firstEvent) out << ",\n";
+        firstEvent = false;
+        out << "{\"ph\":\"" << e.phase << "\",\"pid\":1,\"tid\":1,\"ts\":" << e.ts
+            << ",\"name\":\"" << e.name << "\"";
+        if(e.phase == 'i') out << ",\"s\":\"t\"";
+        if(e.arg) out << ",\"args\":{\"" << e.arg << "\":" << e.value << "}";
+        out << "}";
+    }
+}
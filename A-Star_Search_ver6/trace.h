@@ -0,0 +1,60 @@
+/* 
+ * File:   trace.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Chrome trace-event / Perfetto timeline export
+// Events are buffered in memory by the search thread and a background thread
+// formats them into the JSON trace file, so the search itself only pays for
+// a short locked push_back. Open the file at https://ui.perfetto.dev or in
+// chrome://tracing
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TraceWriter {
+    public:
+    explicit TraceWriter(const std::string &fileName);
+    ~TraceWriter();     // Flushes whatever is left and closes the file
+    
+    bool isOpen() const { return out.is_open(); }
+    
+    // Names must be string literals (or otherwise outlive the writer),
+    // only the pointer is stored
+    void begin(const char *name);                                   // Start of a span
+    void end(const char *name);                                     // End of a span
+    void instant(const char *name, const char *arg, long long value);   // Point event
+    void counter(const char *name, long long value);                // Counter track sample
+    
+    private:
+    struct Event {
+        char phase;         // 'B', 'E', 'i' or 'C'
+        const char *name;
+        const char *arg;
+        long long value;
+        long long ts;       // Microseconds since the writer was created
+    };
+    void push(char phase, const char *name, const char *arg, long long value);
+    void writerLoop();
+    void writeEvents(const std::vector<Event> &events);
+    
+    std::ofstream out;
+    long long startTime;
+    bool firstEvent;
+    bool done;
+    std::vector<Event> pending;     // Filled by the search thread
+    std::mutex lock;
+    std::condition_variable wake;
+    std::thread writer;
+};
+
+#endif /* TRACE_H */
@@ -0,0 +1,33 @@
+/* 
+ * File:   util.cpp
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+#include "util.h"
+using namespace std;
+
+// ====================================================
+// Microseconds since some fixed point (steady clock)
+// ====================================================
+long long nowMicros() {
+    return chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ======================================================================
+// Read the resident set size out of /proc/self/statm (Linux and Cygwin)
+// The second field is the number of resident pages
+// ======================================================================
+long long currentRSS() {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if(!f) return 0;
+    long long pages = 0, resident = 0;
+    if(fscanf(f, "%lld %lld", &pages, &resident) != 2) resident = 0;
+    fclose(f);
+    return resident * sysconf(_SC_PAGESIZE);
+}
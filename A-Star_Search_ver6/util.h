@@ -0,0 +1,19 @@
+/* 
+ * File:   util.h
+ * Author: Arthur Choy
+ *
+ * Created on October 19, 2026
+ */
+
+// Small platform helpers shared by the instrumentation code
+
+#ifndef UTIL_H
+#define UTIL_H
+
+// Microseconds on a monotonic clock, only useful for differences
+long long nowMicros();
+
+// Resident set size of this process in bytes, 0 if the platform can't tell us
+long long currentRSS();
+
+#endif /* UTIL_H */